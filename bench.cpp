@@ -0,0 +1,617 @@
+/*
+ * Copyright 2016 Nils Christopher Brause
+ *
+ * This file is part of libqre.
+ *
+ * libqre is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libqre is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libqre.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Benchmark suite. Build and run with "scons bench".
+//
+// For every case the pattern is compiled and matched against a generated
+// corpus. Reported are the compile time, the throughput, the latency of
+// single calls, the peak heap usage and the same numbers for std::regex,
+// if the pattern can be expressed there. Sets of patterns measure the
+// compile throughput in patterns per second. The results are written as JSON
+// to stdout or to the file given as the first argument.
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <random>
+#include <regex>
+#include <sstream>
+#include <sys/resource.h>
+#include <qre.hpp>
+
+// heap accounting ------------------------------------------------------------
+
+namespace
+{
+  size_t heap_current = 0;
+  size_t heap_peak = 0;
+  size_t heap_allocations = 0;
+
+  // every block remembers its size in front of the user data
+  const size_t header = alignof(max_align_t);
+
+  void *allocate(size_t size)
+  {
+    char *p = static_cast<char*>(std::malloc(size + header));
+    if(!p)
+      throw std::bad_alloc();
+    *reinterpret_cast<size_t*>(p) = size;
+    heap_allocations++;
+    heap_current += size;
+    heap_peak = std::max(heap_peak, heap_current);
+    return p + header;
+  }
+
+  void deallocate(void *ptr)
+  {
+    if(!ptr)
+      return;
+    char *p = static_cast<char*>(ptr) - header;
+    heap_current -= *reinterpret_cast<size_t*>(p);
+    std::free(p);
+  }
+
+  // peak heap usage since the last call
+  size_t reset_peak()
+  {
+    size_t result = heap_peak;
+    heap_peak = heap_current;
+    return result;
+  }
+}
+
+void *operator new(size_t size) { return allocate(size); }
+void *operator new[](size_t size) { return allocate(size); }
+void operator delete(void *ptr) noexcept { deallocate(ptr); }
+void operator delete[](void *ptr) noexcept { deallocate(ptr); }
+
+// corpora --------------------------------------------------------------------
+
+namespace
+{
+  std::mt19937 rng(42);
+
+  unsigned int rand(unsigned int n) { return rng() % n; }
+
+  template <typename T, size_t N>
+  const T &pick(const T (&a)[N]) { return a[rand(N)]; }
+
+  std::string number(unsigned int digits)
+  {
+    std::string result;
+    for(unsigned int c = 0; c < digits; c++)
+      result.push_back('0' + rand(10));
+    return result;
+  }
+
+  std::string word(unsigned int min, unsigned int max)
+  {
+    std::string result;
+    for(unsigned int c = min + rand(max - min + 1); c > 0; c--)
+      result.push_back('a' + rand(26));
+    return result;
+  }
+
+  std::vector<std::string> log_lines(unsigned int n)
+  {
+    const char *levels[] = { "DEBUG", "INFO", "INFO", "INFO", "WARN", "ERROR" };
+    std::vector<std::string> result;
+    for(unsigned int c = 0; c < n; c++)
+      result.push_back("2016-0" + number(1) + "-1" + number(1) + " "
+                       + "1" + number(1) + ":" + "3" + number(1) + ":"
+                       + "4" + number(1) + " [" + pick(levels) + "] "
+                       + word(3, 10) + " " + word(2, 8) + " id=" + number(6)
+                       + " from 10.0." + number(2) + "." + number(2));
+    return result;
+  }
+
+  std::vector<std::string> http_lines(unsigned int n)
+  {
+    const char *methods[] = { "GET", "GET", "GET", "POST", "PUT", "DELETE", "OPTIONS" };
+    std::vector<std::string> result;
+    for(unsigned int c = 0; c < n; c++)
+      {
+        std::string path;
+        for(unsigned int d = 1 + rand(4); d > 0; d--)
+          path += "/" + word(2, 12);
+        if(rand(3) == 0)
+          path += "?q=" + word(1, 8) + "&page=" + number(2);
+        result.push_back(std::string(pick(methods)) + " " + path + " HTTP/1."
+                         + (rand(4) ? "1" : "0"));
+      }
+    return result;
+  }
+
+  std::vector<std::string> emails(unsigned int n)
+  {
+    const char *tlds[] = { "com", "org", "net", "de", "co.uk" };
+    std::vector<std::string> result;
+    for(unsigned int c = 0; c < n; c++)
+      {
+        std::string mail = word(1, 10) + (rand(2) ? "." + word(1, 8) : "")
+          + "@" + word(3, 10) + "." + pick(tlds);
+        // some invalid addresses
+        const char invalid[] = { ' ', '@', ',', ';' };
+        if(rand(5) == 0)
+          mail[rand(mail.size())] = pick(invalid);
+        result.push_back(mail);
+      }
+    return result;
+  }
+
+  std::vector<std::string> urls(unsigned int n)
+  {
+    std::vector<std::string> result;
+    for(unsigned int c = 0; c < n; c++)
+      result.push_back(std::string(rand(2) ? "https" : "http") + "://"
+                       + (rand(2) ? "www." : "") + word(3, 12) + ".com"
+                       + (rand(4) ? "" : ":" + number(4)) + "/" + word(0, 10)
+                       + "/" + word(1, 10) + ".html");
+    return result;
+  }
+
+  std::vector<std::string> utf8_text(unsigned int n)
+  {
+    const char *words[] = { u8"Käse", u8"straße", u8"café", u8"naïve", u8"Ελλάδα",
+                            u8"καλημέρα", u8"Москва", u8"привет", u8"日本語",
+                            u8"東京", u8"שלום", u8"مرحبا", u8"٣٤٥", u8"१२३" };
+    std::vector<std::string> result;
+    for(unsigned int c = 0; c < n; c++)
+      {
+        std::string line;
+        for(unsigned int d = 4 + rand(8); d > 0; d--)
+          line += std::string(pick(words)) + (rand(3) ? " " : " " + number(3) + " ");
+        result.push_back(line);
+      }
+    return result;
+  }
+
+  std::vector<std::string> hashes(unsigned int n)
+  {
+    const char hex[] = "0123456789abcdef";
+    std::vector<std::string> result;
+    for(unsigned int c = 0; c < n; c++)
+      {
+        std::string line = "commit ";
+        // every fourth hash is too short
+        for(unsigned int d = rand(4) ? 64 : 63; d > 0; d--)
+          line.push_back(hex[rand(16)]);
+        result.push_back(line + " " + word(5, 20));
+      }
+    return result;
+  }
+
+  // one large buffer, searched in a single call
+  std::vector<std::string> prose(unsigned int size)
+  {
+    std::string text;
+    while(text.size() < size)
+      text += word(1, 9) + (rand(12) ? " " : ".\n");
+    return { text + "the zebra42 is here" };
+  }
+
+  std::vector<std::string> repeated(char ch, unsigned int min, unsigned int max)
+  {
+    std::vector<std::string> result;
+    for(unsigned int n = min; n <= max; n++)
+      result.push_back(std::string(n, ch));
+    return result;
+  }
+
+  // patterns for the compile benchmarks
+
+  std::vector<std::string> literal_patterns(unsigned int n)
+  {
+    std::vector<std::string> result;
+    for(unsigned int c = 0; c < n; c++)
+      result.push_back(word(5, 30));
+    return result;
+  }
+
+  std::vector<std::string> mixed_patterns(unsigned int n)
+  {
+    const char *atoms[] = { "\\d", "\\w", "\\s", "[a-z]", "[^0-9]", "[A-Fa-f0-9]",
+                            ".", "\\.", "-", "@", "x", "(?:ab|cd)", "(\\w+)", "\\p{L}" };
+    const char *quantifiers[] = { "", "", "", "?", "*", "+", "{2}", "{1,3}", "+?" };
+    std::vector<std::string> result;
+    for(unsigned int c = 0; c < n; c++)
+      {
+        std::string pattern = rand(2) ? "^" : "";
+        for(unsigned int d = 4 + rand(12); d > 0; d--)
+          pattern += std::string(pick(atoms)) + pick(quantifiers);
+        result.push_back(pattern + (rand(2) ? "$" : ""));
+      }
+    return result;
+  }
+
+  std::vector<std::string> nested_patterns(unsigned int n, unsigned int depth)
+  {
+    std::vector<std::string> result;
+    for(unsigned int c = 0; c < n; c++)
+      result.push_back(std::string(depth, '(') + word(1, 3) + std::string(depth, ')'));
+    return result;
+  }
+
+  std::vector<std::string> dictionary_patterns(unsigned int n, unsigned int words)
+  {
+    std::vector<std::string> result;
+    for(unsigned int c = 0; c < n; c++)
+      {
+        std::string pattern = "(?:" + word(3, 12);
+        for(unsigned int d = 1; d < words; d++)
+          pattern += "|" + word(3, 12);
+        result.push_back(pattern + ")");
+      }
+    return result;
+  }
+}
+
+// measurements ---------------------------------------------------------------
+
+namespace
+{
+  typedef std::chrono::steady_clock clock_type;
+
+  double seconds(clock_type::time_point begin, clock_type::time_point end)
+  {
+    return std::chrono::duration<double>(end - begin).count();
+  }
+
+  struct result_t
+  {
+    bool supported = false;
+    double compile_us = 0; // median compile time
+    double mb_per_s = 0; // throughput over all calls
+    double p50_ns = 0, p90_ns = 0, p99_ns = 0, max_ns = 0; // latency per call
+    size_t compile_heap = 0; // peak heap while compiling
+    size_t match_heap = 0; // peak heap while matching
+    unsigned int matches = 0; // matches per pass over the corpus
+    std::string error;
+  };
+
+  double percentile(std::vector<double> &v, double p)
+  {
+    size_t n = std::min(v.size() - 1, static_cast<size_t>(p * v.size()));
+    std::nth_element(v.begin(), v.begin() + n, v.end());
+    return v[n];
+  }
+
+  // 'compile' returns a function that matches one input
+  template <typename compile_t>
+  result_t measure(compile_t compile, const std::vector<std::string> &corpus,
+                   double budget)
+  {
+    result_t result;
+    result.supported = true;
+
+    // compile time
+    std::vector<double> times;
+    reset_peak();
+    size_t before = heap_current;
+    auto begin = clock_type::now();
+    do
+      {
+        auto t = clock_type::now();
+        compile();
+        times.push_back(seconds(t, clock_type::now()) * 1e6);
+      }
+    while(seconds(begin, clock_type::now()) < budget / 4 && times.size() < 1000);
+    result.compile_us = percentile(times, 0.5);
+    result.compile_heap = reset_peak() - before;
+
+    // heap usage of matching, without the bookkeeping below
+    auto matcher = compile();
+    reset_peak();
+    before = heap_current;
+    for(auto &input : corpus)
+      matcher(input);
+    result.match_heap = reset_peak() - before;
+
+    // matching
+    std::vector<double> latencies;
+    size_t bytes = 0;
+    double total = 0;
+    begin = clock_type::now();
+    do
+      {
+        result.matches = 0;
+        for(auto &input : corpus)
+          {
+            auto t = clock_type::now();
+            bool matched = matcher(input);
+            double elapsed = seconds(t, clock_type::now());
+            result.matches += matched;
+            latencies.push_back(elapsed * 1e9);
+            total += elapsed;
+            bytes += input.size();
+          }
+      }
+    while(seconds(begin, clock_type::now()) < budget);
+
+    result.mb_per_s = bytes / total / 1e6;
+    result.p50_ns = percentile(latencies, 0.5);
+    result.p90_ns = percentile(latencies, 0.9);
+    result.p99_ns = percentile(latencies, 0.99);
+    result.max_ns = *std::max_element(latencies.begin(), latencies.end());
+    return result;
+  }
+
+  result_t measure_qre(const std::string &pattern, qre::match_flag flags,
+                       const std::vector<std::string> &corpus, double budget)
+  {
+    try
+      {
+        return measure([&pattern, flags] ()
+                       {
+                         std::shared_ptr<qre> r = std::make_shared<qre>(pattern);
+                         std::shared_ptr<qre::match> m = std::make_shared<qre::match>();
+                         return [r, m, flags] (const std::string &s)
+                           { return (*r)(s, *m, flags); };
+                       }, corpus, budget);
+      }
+    catch(std::exception &e)
+      {
+        result_t result;
+        result.error = e.what();
+        return result;
+      }
+  }
+
+  result_t measure_std(const std::string &pattern, const std::vector<std::string> &corpus,
+                       double budget)
+  {
+    if(pattern.empty())
+      return result_t();
+    try
+      {
+        return measure([&pattern] ()
+                       {
+                         std::shared_ptr<std::regex> r = std::make_shared<std::regex>(pattern);
+                         std::shared_ptr<std::smatch> m = std::make_shared<std::smatch>();
+                         return [r, m] (const std::string &s)
+                           { return std::regex_search(s, *m, *r); };
+                       }, corpus, budget);
+      }
+    catch(std::exception &e)
+      {
+        result_t result;
+        result.error = e.what();
+        return result;
+      }
+  }
+
+  struct compile_result_t
+  {
+    unsigned int patterns = 0;
+    double patterns_per_s = 0;
+    double allocations = 0; // heap allocations per pattern
+    std::string error;
+  };
+
+  compile_result_t measure_compile(const std::vector<std::string> &patterns,
+                                   double budget)
+  {
+    compile_result_t result;
+    result.patterns = patterns.size();
+    try
+      {
+        size_t before = heap_allocations;
+        for(auto &pattern : patterns)
+          qre r(pattern);
+        result.allocations = static_cast<double>(heap_allocations - before) / patterns.size();
+
+        size_t compiled = 0;
+        auto begin = clock_type::now();
+        do
+          {
+            for(auto &pattern : patterns)
+              qre r(pattern);
+            compiled += patterns.size();
+          }
+        while(seconds(begin, clock_type::now()) < budget);
+        result.patterns_per_s = compiled / seconds(begin, clock_type::now());
+      }
+    catch(std::exception &e)
+      {
+        result.error = e.what();
+      }
+    return result;
+  }
+
+  std::string json_string(const std::string &str)
+  {
+    std::string result = "\"";
+    for(unsigned char ch : str)
+      if(ch == '"' || ch == '\\')
+        result += std::string("\\") + static_cast<char>(ch);
+      else if(ch < 0x20)
+        {
+          char buf[8];
+          std::snprintf(buf, sizeof(buf), "\\u%04x", ch);
+          result += buf;
+        }
+      else
+        result.push_back(ch);
+    return result + "\"";
+  }
+
+  std::string json(const result_t &r)
+  {
+    std::ostringstream out;
+    if(!r.supported)
+      return r.error.empty() ? "null" : "{ \"error\": " + json_string(r.error) + " }";
+    out << "{ \"compile_us\": " << r.compile_us
+        << ", \"mb_per_s\": " << r.mb_per_s
+        << ", \"latency_ns\": { \"p50\": " << r.p50_ns << ", \"p90\": " << r.p90_ns
+        << ", \"p99\": " << r.p99_ns << ", \"max\": " << r.max_ns << " }"
+        << ", \"peak_heap_bytes\": { \"compile\": " << r.compile_heap
+        << ", \"match\": " << r.match_heap << " }"
+        << ", \"matches\": " << r.matches << " }";
+    return out.str();
+  }
+
+  std::string json(const compile_result_t &r)
+  {
+    std::ostringstream out;
+    if(!r.error.empty())
+      return "{ \"error\": " + json_string(r.error) + " }";
+    out << "{ \"patterns_per_s\": " << r.patterns_per_s
+        << ", \"allocations_per_pattern\": " << r.allocations << " }";
+    return out.str();
+  }
+}
+
+// cases ----------------------------------------------------------------------
+
+namespace
+{
+  struct bench_case
+  {
+    std::string name;
+    std::string pattern;
+    std::string std_pattern; // ECMAScript equivalent, empty if there is none
+    qre::match_flag flags;
+    std::vector<std::string> corpus;
+    double budget; // seconds per engine and phase
+  };
+}
+
+int main(int argc, char **argv)
+{
+  const qre::match_flag none = qre::match_flag::none;
+  const qre::match_flag utf8 = qre::match_flag::utf8;
+
+  std::vector<bench_case> cases =
+    {
+      { "log/level",
+        "^(\\d{4}-\\d{2}-\\d{2}) (\\d{2}:\\d{2}:\\d{2}) \\[(ERROR|WARN)\\] (.*)$",
+        "^(\\d{4}-\\d{2}-\\d{2}) (\\d{2}:\\d{2}:\\d{2}) \\[(ERROR|WARN)\\] (.*)$",
+        none, log_lines(2000), 0.2 },
+      { "log/ip",
+        "from \\d{1,3}\\.\\d{1,3}\\.\\d{1,3}\\.\\d{1,3}$",
+        "from \\d{1,3}\\.\\d{1,3}\\.\\d{1,3}\\.\\d{1,3}$",
+        none, log_lines(2000), 0.2 },
+      { "http/request",
+        "^(?:GET|POST|PUT|DELETE|HEAD) /[^ ?]*(?:\\?[^ ]*)? HTTP/1\\.[01]$",
+        "^(?:GET|POST|PUT|DELETE|HEAD) /[^ ?]*(?:\\?[^ ]*)? HTTP/1\\.[01]$",
+        none, http_lines(2000), 0.2 },
+      { "email/validate",
+        "^[\\w.+-]+@[\\w-]+(?:\\.[\\w-]+)+$",
+        "^[\\w.+-]+@[\\w-]+(?:\\.[\\w-]+)+$",
+        none, emails(2000), 0.2 },
+      { "url/validate",
+        "^https?://[\\w.-]+(?::\\d+)?(?:/[\\w.%-]*)*$",
+        "^https?://[\\w.-]+(?::\\d+)?(?:/[\\w.%-]*)*$",
+        none, urls(2000), 0.2 },
+      { "redos/nested",
+        "^(?:a+)+b",
+        "^(?:a+)+b",
+        none, repeated('a', 10, 22), 0.2 },
+      { "redos/alternation",
+        "^(?:a|aa)+$",
+        "^(?:a|aa)+$",
+        none, repeated('a', 10, 40), 0.2 },
+      { "redos/captures",
+        "^(\\w+\\s?)*$",
+        "^(\\w+\\s?)*$",
+        none, { "aaaaaaaaaaaaaaaaaa!", "aaaa aaaa aaaa aaaa!" }, 0.2 },
+      { "utf8/words",
+        "\\p{L}+ \\p{Nd}+ \\p{L}+",
+        "",
+        utf8, utf8_text(1000), 0.2 },
+      { "utf8/scripts",
+        "[\\p{L}&&[^a-zA-Z]]{4,}",
+        "",
+        utf8, utf8_text(1000), 0.2 },
+      { "counted/hash",
+        "commit [0-9a-f]{64} ",
+        "commit [0-9a-f]{64} ",
+        none, hashes(2000), 0.2 },
+      { "counted/range",
+        "(?:[a-z]{2,8} ){20,40}",
+        "(?:[a-z]{2,8} ){20,40}",
+        none, prose(1 << 16), 0.2 },
+      { "search/literal",
+        "zebra\\d+",
+        "zebra\\d+",
+        none, prose(1 << 20), 0.2 },
+    };
+
+  std::ostringstream out;
+  out << "{\n  \"benchmarks\": [\n";
+  for(unsigned int c = 0; c < cases.size(); c++)
+    {
+      auto &bc = cases[c];
+      size_t size = 0;
+      for(auto &input : bc.corpus)
+        size += input.size();
+      std::cerr << bc.name << std::endl;
+
+      out << "    { \"name\": " << json_string(bc.name)
+          << ", \"pattern\": " << json_string(bc.pattern)
+          << ", \"inputs\": " << bc.corpus.size()
+          << ", \"bytes\": " << size << ",\n"
+          << "      \"qre\": " << json(measure_qre(bc.pattern, bc.flags, bc.corpus, bc.budget))
+          << ",\n"
+          << "      \"std_regex\": " << json(measure_std(bc.std_pattern, bc.corpus, bc.budget))
+          << " }" << (c + 1 < cases.size() ? "," : "") << "\n";
+    }
+
+  std::vector<std::string> bench_patterns;
+  for(auto &bc : cases)
+    bench_patterns.push_back(bc.pattern);
+  std::vector<std::pair<std::string, std::vector<std::string>>> sets =
+    {
+      { "compile/bench", bench_patterns },
+      { "compile/literal", literal_patterns(1000) },
+      { "compile/mixed", mixed_patterns(1000) },
+      { "compile/nested", nested_patterns(10, 1000) },
+      { "compile/dictionary", dictionary_patterns(10, 1000) },
+    };
+
+  out << "  ],\n  \"compile\": [\n";
+  for(unsigned int c = 0; c < sets.size(); c++)
+    {
+      std::cerr << sets[c].first << std::endl;
+      out << "    { \"name\": " << json_string(sets[c].first)
+          << ", \"patterns\": " << sets[c].second.size()
+          << ",\n      \"qre\": " << json(measure_compile(sets[c].second, 0.5))
+          << " }" << (c + 1 < sets.size() ? "," : "") << "\n";
+    }
+
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  out << "  ],\n  \"max_rss_kb\": " << usage.ru_maxrss << "\n}\n";
+
+  if(argc > 1)
+    {
+      std::ofstream file(argv[1]);
+      file << out.str();
+    }
+  else
+    std::cout << out.str();
+
+  return 0;
+}
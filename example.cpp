@@ -1,6 +1,13 @@
 #include <cassert>
+#include <deque>
 #include <iostream>
+#include <vector>
 #include <qre.hpp>
+#ifdef __unix__
+#include <cstdio>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 int main()
 {
@@ -239,6 +246,11 @@ int main()
   assert(r31("abcd", result));
   assert(result.str == "abcd");
   assert(!r31("abd", result));
+  qre r31b("(?>a*)b");
+  bool anchored31 = r31b("aab", result, qre::match_flag::fix_left | qre::match_flag::fix_right);
+  assert(anchored31 == r31b("aab", result, qre::match_flag::fix_right));
+  r31b.use_engine(qre::engine_type::backtrack);
+  assert(anchored31 == r31b("aab", result, qre::match_flag::fix_left | qre::match_flag::fix_right));
 
   // multiline mode
   qre r32("^123$^abc$^456$");
@@ -258,6 +270,16 @@ int main()
   assert(r33c(u8"€", result));
   assert(result.str == u8"€");
   assert(!r33c(u8"€", result, qre::match_flag::utf8));
+  qre r33d("a.c");
+  assert(r33d(u8"a€c", result, qre::match_flag::utf8));
+  assert(result.str == u8"a€c");
+  assert(r33d(u8"a€c", result, qre::match_flag::assume_valid_utf8));
+  assert(result.str == u8"a€c");
+  assert(r33d("abc", result, qre::match_flag::utf8));
+  bool invalid = false;
+  try { r33d("a\xE2\x82" "c", result, qre::match_flag::utf8); }
+  catch(std::runtime_error &e) { invalid = true; }
+  assert(invalid);
 
   // backreferences
   qre r34a("(.)(.)\\g<2>\\g<1>");
@@ -325,6 +347,440 @@ int main()
   assert(r37("abcd", result, qre::match_flag::longest));
   assert(result.str == "abcd");
 
+  // leftmost-longest match
+  qre r37b("a|bcd");
+  assert(r37b("abcd", result, qre::match_flag::longest));
+  assert(result.str == "a");
+  assert(result.pos == 0);
+  qre r37c("(a|ab)(c|bcd)");
+  assert(r37c("xabcd", result, qre::match_flag::longest));
+  assert(result.str == "abcd");
+  assert(result.pos == 1);
+  assert(result.sub[0].back() == "a");
+  assert(result.sub[1].back() == "bcd");
+  qre r37d("(a|b)(?:\\1|c*)");
+  assert(r37d("xbcc", result, qre::match_flag::longest));
+  assert(result.str == "bcc");
+  assert(result.sub[0].back() == "b");
+
+  // one-pass patterns
+  qre r38("([0-9]+)-([a-z]+)(?:;(?<x>[^;]*))?");
+  assert(r38("2016-abc;def", result, qre::match_flag::fix_left | qre::match_flag::fix_right));
+  assert(result.str == "2016-abc;def");
+  assert(result.sub[0].back() == "2016");
+  assert(result.sub[1].back() == "abc");
+  assert(result.named_sub["x"].back() == "def");
+  assert(r38("7-x;", result, qre::match_flag::fix_left | qre::match_flag::fix_right));
+  assert(result.sub[0].back() == "7");
+  assert(result.named_sub["x"].back() == "");
+  assert(!r38("2016-ab1", result, qre::match_flag::fix_left | qre::match_flag::fix_right));
+
+  // searching without captures
+  qre r39("[a-c]+d|x$");
+  assert(r39("xxabcabdx", result));
+  assert(result.str == "abcabd");
+  assert(result.pos == 2);
+  assert(r39("yxyx", result));
+  assert(result.str == "x");
+  assert(result.pos == 3);
+  assert(r39("dx\nabd", result, qre::match_flag::multiline));
+  assert(result.str == "x\n");
+  assert(result.pos == 1);
+
+  // UTF-8 search on bytes
+  qre r40(u8"[α-ω]+.€");
+  assert(r40(u8"xαβγ𝄞€", result, qre::match_flag::utf8));
+  assert(result.str == u8"αβγ𝄞€");
+  assert(result.pos == 1);
+  assert(!r40(u8"α€", result, qre::match_flag::utf8));
+  assert(r40(u8"Ωαβ€", result, qre::match_flag::utf8));
+  assert(result.str == u8"αβ€");
+  assert(result.pos == 2);
+
+  // case-insensitive matching
+  qre r41a("error", qre::compile_flag::icase);
+  assert(r41a("An ERROR occurred", result));
+  assert(result.str == "ERROR");
+  assert(result.pos == 3);
+  assert(!r41a("An err0r occurred", result));
+  qre r41b(u8"(?i)σ+");
+  assert(r41b(u8"ΣσςΣ", result, qre::match_flag::utf8 | qre::match_flag::fix_left
+              | qre::match_flag::fix_right));
+  qre r41c("a(?i:b)c");
+  assert(r41c("aBc", result));
+  assert(!r41c("aBC", result));
+  qre r41d("(?i)a(?-i)b");
+  assert(r41d("Ab", result));
+  assert(!r41d("AB", result));
+  qre r41e("(?i)([a-z])\\1k");
+  assert(r41e(u8"xaA\u212A", result, qre::match_flag::utf8));
+  assert(result.str == u8"aA\u212A");
+  qre r41f(u8"(?i)\u0180\u01C6\u13A0\U000104D8");
+  assert(r41f(u8"x\u0243\u01C5\uAB70\U000104B0", result, qre::match_flag::utf8));
+  assert(result.str == u8"\u0243\u01C5\uAB70\U000104B0");
+  assert(r41f(u8"\u0180\u01C4\u13A0\U000104D8", result, qre::match_flag::utf8));
+  assert(!r41f(u8"\u0180\u01C7\u13A0\U000104D8", result, qre::match_flag::utf8));
+
+  // predefined classes and Unicode properties
+  qre r42a("\\d+\\s\\w+");
+  assert(r42a(u8"x \u0663\u0664\u3000\u00E9t\u00E9!", result, qre::match_flag::utf8));
+  assert(result.str == u8"\u0663\u0664\u3000\u00E9t\u00E9");
+  qre r42b("\\p{Lu}\\p{Ll}+\\P{L}");
+  assert(r42b(u8"\u0394\u03B5\u03BB\u03C4\u03B1!", result, qre::match_flag::utf8));
+  assert(!r42b(u8"\u03B4\u03B5\u03BB\u03C4\u03B1!", result, qre::match_flag::utf8));
+  qre r42c("[\\w-[\\d]]+");
+  assert(r42c("42abc7", result));
+  assert(result.str == "abc");
+  qre r42d("[\\pL&&[^a-z]]");
+  assert(r42d("abcD", result));
+  assert(result.str == "D");
+  qre r42e("[^\\S\\n]");
+  assert(r42e("a\nb c", result));
+  assert(result.str == " ");
+  unsigned int unterminated42 = 0;
+  for(auto pattern : { "\\p{L", "\\p{Lu", "\\P{" })
+    try
+      {
+        qre r42f(pattern);
+      }
+    catch(std::runtime_error &e)
+      {
+        unterminated42++;
+      }
+  assert(unterminated42 == 3);
+
+  // match statistics
+  qre::match_stats stats;
+  qre r43a("(a|ab)(c|bcd)(d*)");
+  assert(r43a("aabcd", result, qre::match_flag::none, &stats));
+  assert(stats.engine == qre::engine_type::backtrack);
+  assert(stats.start_positions == 3); // two in the search, one for captures
+  assert(stats.transitions > stats.checks_failed);
+  assert(stats.max_history > 0);
+  qre r43b("[0-9]+x");
+  assert(r43b("12 34x", result, qre::match_flag::none, &stats));
+  assert(stats.engine == qre::engine_type::automaton);
+  assert(stats.transitions == 0);
+
+  // limits
+  qre r44("(a|aa)+(b|c)");
+  r44.use_engine(qre::engine_type::backtrack);
+  qre::match_limits limits;
+  limits.max_steps = 1000;
+  assert(!r44(std::string(40, 'a'), result, qre::match_flag::none, nullptr, &limits));
+  assert(result.type == qre::match_type::aborted);
+  assert(result.limit == qre::limit_type::steps);
+  assert(r44("aab", result, qre::match_flag::none, nullptr, &limits));
+  limits = qre::match_limits();
+  limits.max_memory = 16 * 64;
+  assert(!r44(std::string(40, 'a'), result, qre::match_flag::none, nullptr, &limits));
+  assert(result.limit == qre::limit_type::memory);
+  limits = qre::match_limits();
+  limits.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(10);
+  assert(!r44(std::string(40, 'a'), result, qre::match_flag::none, nullptr, &limits));
+  assert(result.limit == qre::limit_type::deadline);
+  std::atomic<bool> cancel(true);
+  limits = qre::match_limits();
+  limits.cancel = &cancel;
+  assert(!r44(std::string(40, 'a'), result, qre::match_flag::none, nullptr, &limits));
+  assert(result.limit == qre::limit_type::cancelled);
+
+  // complexity analysis
+  qre r45a("(a+)+b");
+  qre::complexity_t cx = r45a.complexity();
+  assert(cx.type == qre::complexity_type::exponential);
+  assert(cx.pump.size() > 0);
+  assert(cx.backtracking);
+  qre r45b("^a*a*b");
+  cx = r45b.complexity();
+  assert(cx.type == qre::complexity_type::polynomial);
+  assert(cx.degree == 2);
+  assert(cx.pump == "a");
+  qre r45c("abc");
+  assert(r45c.complexity().type == qre::complexity_type::linear);
+  qre r45d("(a{1,3}){1,50}b");
+  assert(r45d.complexity().type == qre::complexity_type::exponential);
+  // attacks are input the pattern does not match
+  qre r45e("x{1,1000}");
+  cx = r45e.complexity();
+  assert(cx.type == qre::complexity_type::unknown && cx.pump.empty());
+  cx = r45e.complexity(qre::match_flag::fix_right);
+  assert(cx.type == qre::complexity_type::polynomial && cx.degree == 2);
+  assert(!r45e(cx.prefix + cx.pump + cx.pump + cx.suffix, result, qre::match_flag::fix_right));
+  qre r45f("(.*)=(.*)");
+  cx = r45f.complexity();
+  assert(cx.type == qre::complexity_type::polynomial && cx.degree == 2);
+  assert(!r45f(cx.prefix + cx.pump + cx.pump + cx.suffix, result));
+  qre r45g("^a*a*a*b");
+  cx = r45g.complexity();
+  assert(cx.type == qre::complexity_type::polynomial && cx.degree == 3);
+  assert(!r45g(cx.prefix + cx.pump + cx.pump + cx.suffix, result));
+
+  // engine selection
+  qre::match_stats stats46;
+  qre r46a("needle");
+  assert(r46a("haystack with a needle", result, qre::match_flag::none, &stats46));
+  assert(result.pos == 16 && result.str == "needle");
+  assert(stats46.engine == qre::engine_type::literal);
+  assert(!r46a("needl", result, qre::match_flag::none, &stats46));
+  assert(stats46.engine == qre::engine_type::none);
+  qre r46b("(a+)(b+)");
+  assert(r46b("xxaabbb", result, qre::match_flag::none, &stats46));
+  assert(stats46.engine == qre::engine_type::backtrack);
+  assert(r46b(std::string(20, 'x') + "aabbb", result, qre::match_flag::none, &stats46));
+  assert(stats46.engine == qre::engine_type::automaton_backtrack);
+  assert(result.sub[0].back() == "aa" && result.sub[1].back() == "bbb");
+  assert(r46b("aabbb", result, qre::match_flag::fix_left | qre::match_flag::fix_right, &stats46));
+  assert(stats46.engine == qre::engine_type::onepass);
+  qre r46c("a+b+");
+  assert(r46c("xxaabbb", result, qre::match_flag::none, &stats46));
+  assert(stats46.engine == qre::engine_type::automaton);
+  r46b.use_engine(qre::engine_type::backtrack);
+  assert(r46b(std::string(20, 'x') + "aabbb", result, qre::match_flag::none, &stats46));
+  assert(stats46.engine == qre::engine_type::backtrack);
+  assert(result.sub[0].back() == "aa" && result.sub[1].back() == "bbb");
+  r46b.use_engine(qre::engine_type::onepass);
+  bool thrown46 = false;
+  try
+    {
+      r46b("aabbb", result);
+    }
+  catch(std::runtime_error &e)
+    {
+      thrown46 = true;
+    }
+  assert(thrown46);
+  qre r46d("(a)|(b)(c)?|(?<n>d)");
+  assert(r46d("b", result, qre::match_flag::fix_left | qre::match_flag::fix_right, &stats46));
+  assert(stats46.engine == qre::engine_type::onepass);
+  assert(result.sub.size() == 3 && result.sub[0].empty() && result.sub[1].back() == "b");
+  assert(result.named_sub.size() == 1 && result.named_sub["n"].empty());
+  assert(r46d(std::string(20, 'x') + "b", result, qre::match_flag::none, &stats46));
+  assert(stats46.engine == qre::engine_type::automaton_backtrack);
+  assert(result.sub.size() == 3 && result.sub[1].back() == "b" && result.named_sub.size() == 1);
+  r46d.use_engine(qre::engine_type::backtrack);
+  assert(r46d("xb", result));
+  assert(result.sub.size() == 3 && result.sub[1].back() == "b" && result.named_sub.size() == 1);
+
+  // large patterns are copied and destroyed without recursion
+  qre r47a("(?:ab|c){1,2000}d");
+  qre r47b(r47a);
+  assert(r47b(std::string(5000, 'c') + "d", result));
+  assert(result.str.length() == 2001);
+
+  // copies and moves keep the engines of the original
+  qre::match_stats stats47;
+  qre *r47c = new qre("(a+)(b+),");
+  qre r47d(*r47c);
+  qre r47e;
+  r47e = *r47c;
+  delete r47c;
+  assert(r47d("aabbb,", result, qre::match_flag::fix_left | qre::match_flag::fix_right, &stats47));
+  assert(stats47.engine == qre::engine_type::onepass && result.sub[1].back() == "bbb");
+  assert(r47e(std::string(20, 'x') + "aabbb,", result, qre::match_flag::none, &stats47));
+  assert(stats47.engine == qre::engine_type::automaton_backtrack && result.sub[0].back() == "aa");
+  qre r47f(std::move(r47d));
+  r47e = std::move(r47f);
+  // objects moved from still match
+  assert(r47d("ab", result) && result.pos == 0 && result.str.empty());
+  assert(r47d.test("ab") && r47d.count("ab") == 3);
+  assert(r47f("aab,", result) && result.sub[1].back() == "b");
+  r47e.use_engine(qre::engine_type::backtrack);
+  assert(r47e("ab aabbb,", result) && result.pos == 3 && result.sub[1].back() == "bbb");
+
+  // alternations of literals
+  qre r48a("(?:foo|foobar|bar|baz)+!");
+  assert(r48a("xfoobarbaz!", result));
+  assert(result.pos == 1 && result.str == "foobarbaz!");
+  qre r48b("(a|ab)(c|bcd)");
+  assert(r48b("abcd", result));
+  assert(result.sub[0].back() == "a" && result.sub[1].back() == "bcd");
+  qre r48c("(?:ab|a)");
+  assert(r48c("abc", result) && result.str == "ab");
+  qre r48d("(?:Apple|apricot|banana)", qre::compile_flag::icase);
+  assert(r48d("an APRICOT", result) && result.str == "APRICOT");
+
+  // deep nesting does not exhaust the stack
+  std::string nested;
+  for(unsigned int c = 0; c < 20000; c++)
+    nested += "(?:";
+  nested += "ab" + std::string(20000, ')') + "+";
+  qre r49a(nested);
+  assert(r49a("xababc", result) && result.str == "abab");
+  qre r49b("((a)(b(c)))");
+  assert(r49b("abc", result) && result.sub[3].back() == "c");
+
+  // captures are recorded only on the match found without them
+  qre r50a("(?>ab|a)(b)");
+  assert(r50a("abab abb", result));
+  assert(result.pos == 5 && result.sub[0].back() == "b");
+  qre r50b("(\\w+)\\R");
+  assert(r50b("ab cd\r\nef", result, qre::match_flag::longest));
+  assert(result.str == "cd\r\n" && result.sub[0].back() == "cd");
+
+  // locating matches only
+  qre r51a("(\\d+)-(\\d+)");
+  assert(r51a.test("ab 12-34 5-6"));
+  assert(!r51a.test("ab 12 34"));
+  qre::span_t span = r51a.find_pos("ab 12-34 5-6");
+  assert(span.found && span.pos == 3 && span.length == 5);
+  assert(!r51a.find_pos("-").found);
+  assert(r51a.count("ab 12-34 5-6") == 2);
+  qre r51b("a*");
+  assert(r51b.count("baab") == 4);
+  qre r51c("^\\w", qre::compile_flag::none);
+  assert(r51c.count("ab\ncd", qre::match_flag::multiline) == 2);
+  qre r51d("\\w+");
+  assert(r51d.count("\xc3\xa4\xc3\xb6 \xc3\xbc", qre::match_flag::utf8) == 2);
+  qre r51e("(a+)(b+)");
+  span = r51e.find_pos("aab", qre::match_flag::fix_left | qre::match_flag::fix_right);
+  assert(span.found && span.pos == 0 && span.length == 3);
+  qre r51f("a");
+  assert(r51f.count("aaa", qre::match_flag::fix_left) == 1);
+  assert(r51f.count("baa", qre::match_flag::fix_left) == 0);
+  qre r51g("(a)*");
+  assert(r51g.count("aa", qre::match_flag::fix_left | qre::match_flag::fix_right) == 1);
+
+  // matching in place over caller buffers
+  const char buf52[] = "key=12 rest";
+  qre r52a("(\\w+)=(\\d+)");
+  assert(!r52a(qre::text(buf52 + 4, 2), result));
+  assert(r52a(qre::text(buf52, 6), result));
+  assert(result.str == "key=12" && result.sub[1].back() == "12");
+  std::vector<char> vec52(buf52, buf52 + 11);
+  assert(r52a(vec52, result));
+  assert(result.sub[0].back() == "key");
+  qre::span_t span52 = r52a.find_pos(qre::text(vec52.begin() + 1, vec52.end()));
+  assert(span52.found && span52.pos == 0 && span52.length == 5);
+  assert(r52a(qre::text(buf52, buf52 + 6), result) && result.str == "key=12");
+  static_assert(!std::is_constructible<qre::text, std::deque<char>::iterator,
+                std::deque<char>::iterator>::value, "deque is not contiguous");
+  assert(r52a.count(qre::text(buf52)) == 1);
+  assert(!r52a.test(qre::text(buf52, 4)));
+
+  // segmented input
+  std::vector<qre::segment> segs53 = { {"ke", 2}, {"", 0}, {"y=1", 3}, {"2 key", 5} };
+  assert(r52a(segs53, result));
+  assert(result.str == "key=12" && result.sub[0].back() == "key");
+  std::vector<qre::segment> segs53b = { {"ab", 2}, {"c a", 3}, {"bc", 2} };
+  qre r53a("(\\w+) \\1");
+  assert(r53a(segs53b, result) && result.sub[0].back() == "abc");
+  qre r53b("y=12");
+  assert(r53b.find_pos(segs53).pos == 2);
+  std::vector<qre::segment> segs53u = { {"\xc3", 1}, {"\xa4x", 2} };
+  qre r53c("^.x$");
+  assert(r53c.test(segs53u, qre::match_flag::utf8));
+
+  // patterns translated into machine code
+  qre r55a("(\\w+)=(\\d+)\\R", qre::compile_flag::jit);
+  assert(r55a.test("a b=12\r\n"));
+  assert(!r55a.test("a b=12 \r\n"));
+  assert(r55a.find_pos("x=1 y=2\r\n").pos == 4);
+  assert(r55a("ab c=7\n", result) && result.pos == 3);
+  assert(result.sub[0].back() == "c" && result.sub[1].back() == "7");
+  assert(r55a("x=1\n", result, qre::match_flag::fix_left | qre::match_flag::fix_right));
+  qre r55b("^b[^\\n]*$", qre::compile_flag::jit);
+  assert(r55b.count("ab\nbc\nb", qre::match_flag::multiline) == 2);
+
+  // long character class runs
+  std::string line57 = "key = \"" + std::string(100, 'v') + "\" " + std::string(70, 'w') + "@x\n";
+  qre r57a("\"[^\"]*\"");
+  assert(r57a(line57, result) && result.pos == 6 && result.str.length() == 102);
+  qre r57b("[a-z]+@");
+  assert(r57b(line57, result) && result.pos == 109 && result.str.length() == 71);
+  qre r57c("^[^\\n]*x$");
+  assert(r57c.count(line57 + line57, qre::match_flag::multiline) == 2);
+  std::vector<qre::segment> segs57 = { { line57.data(), 30 }, { line57.data() + 30, 50 },
+                                       { line57.data() + 80, line57.length() - 80 } };
+  assert(r57b(qre::text(segs57), result) && result.pos == 109);
+
+  // greedy loops over one character test
+  std::string line58 = std::string(10000, 'k') + "=42";
+  qre r58a("^(.*)=(\\d+)$");
+  r58a.use_engine(qre::engine_type::backtrack);
+  qre::match_stats stats58;
+  assert(r58a(line58, result, qre::match_flag::none, &stats58));
+  assert(result.sub[0].back().length() == 10000 && result.sub[1].back() == "42");
+  assert(stats58.max_history < 100);
+  qre r58b("([^x]*)\u00e9");
+  r58b.use_engine(qre::engine_type::backtrack);
+  std::string word58 = u8"a\u00e9\u00fc\u00e9b";
+  assert(r58b(word58, result, qre::match_flag::utf8));
+  assert(result.sub[0].back() == u8"a\u00e9\u00fc");
+  std::vector<qre::segment> segs58 = { { word58.data(), 2 }, { word58.data() + 2, 4 },
+                                       { word58.data() + 6, word58.length() - 6 } };
+  assert(r58b(qre::text(segs58), result, qre::match_flag::utf8));
+  assert(result.sub[0].back() == u8"a\u00e9\u00fc");
+
+  // loops that cannot give back usefully
+  qre r59a("([a-z]+):");
+  r59a.use_engine(qre::engine_type::backtrack);
+  qre::match_stats stats59;
+  assert(!r59a(std::string(5000, 'a'), result, qre::match_flag::none, &stats59));
+  assert(stats59.transitions < 100000);
+  assert(r59a("ab cd:", result) && result.pos == 3 && result.sub[0].back() == "cd");
+  qre r59b("([a-z]+)[a-c]");
+  r59b.use_engine(qre::engine_type::backtrack);
+  assert(r59b("xyzab", result) && result.sub[0].back() == "xyza");
+  qre r59c("([^:]+):");
+  r59c.use_engine(qre::engine_type::backtrack);
+  assert(r59c(u8"x \u00e9\u00e9:", result, qre::match_flag::utf8));
+  assert(result.pos == 0 && result.sub[0].back() == u8"x \u00e9\u00e9");
+
+  // generated standalone matchers
+  qre r56a("(\\d+)-(?<x>[a-f]+)");
+  std::string code56 = r56a.generate("pair");
+  assert(code56.find("inline bool pair(const char *data") != std::string::npos);
+  assert(code56.find("namespace pair") != std::string::npos);
+  qre r56b("(a)\\1");
+  bool thrown56 = false;
+  try
+    {
+      r56b.generate("twice");
+    }
+  catch(std::runtime_error &e)
+    {
+      thrown56 = true;
+    }
+  assert(thrown56);
+  thrown56 = false;
+  try
+    {
+      r56a.generate("2nd");
+    }
+  catch(std::runtime_error &e)
+    {
+      thrown56 = true;
+    }
+  assert(thrown56);
+
+#ifdef __unix__
+  // positions beyond 4 GiB in a sparse file
+  if(sizeof(size_t) > 4)
+    {
+      FILE *file54 = tmpfile();
+      const size_t size54 = (static_cast<size_t>(5) << 30) + 100;
+      const char *map54 = nullptr;
+      if(file54 && ftruncate(fileno(file54), size54) == 0
+         && pwrite(fileno(file54), "=needle", 7, size54 - 7) == 7)
+        map54 = static_cast<const char*>(mmap(nullptr, size54, PROT_READ, MAP_PRIVATE,
+                                               fileno(file54), 0));
+      if(map54 && map54 != MAP_FAILED)
+        {
+          qre::text text54(map54, size54);
+          qre r54a("needle");
+          assert(r54a(text54, result, qre::match_flag::fix_right));
+          assert(result.pos == size54 - 6);
+          qre r54b("=(ne+)dle$");
+          assert(r54b(text54, result));
+          assert(result.pos == size54 - 7 && result.sub[0].back() == "nee");
+          munmap(const_cast<char*>(map54), size54);
+        }
+      if(file54)
+        fclose(file54);
+    }
+#endif
+
   // copy constructor
   qre r95a("abc");
   qre r95b(r95a);
@@ -22,12 +22,21 @@
 #define QRE_HPP
 
 #include <iostream>
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <stack>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
 #include <type_traits>
 #include <vector>
 
@@ -37,37 +46,206 @@ public:
 
   // user interface -----------------------------------------------------------
 
-  enum class match_type { none, full, partial };
+  enum class match_type { none, full, partial, aborted };
+  enum class limit_type : uint8_t { none, steps, memory, deadline, cancelled };
   enum class match_flag : uint8_t
-    { none = 0, partial = 1, fix_left = 2, fix_right = 4, multiline = 8, utf8 = 16, longest = 32 };
+    { none = 0, partial = 1, fix_left = 2, fix_right = 4, multiline = 8, utf8 = 16, longest = 32,
+      assume_valid_utf8 = 64 };
+  enum class compile_flag : uint8_t
+    { none = 0, icase = 1,
+      jit = 2 }; // translate into machine code where supported
 
   struct match
   {
     match_type type; // type of match
-    unsigned int pos; // position of match
+    size_t pos; // position of match
     std::string str; // overall match
-    std::map<uint32_t, std::vector<std::string>> sub; // sub matches
-    std::map<std::string, std::vector<std::string>> named_sub; // named sub matches
+    // sub matches, with an entry for every group, empty if it was not entered
+    std::map<uint32_t, std::vector<std::string>> sub;
+    std::map<std::string, std::vector<std::string>> named_sub;
+    limit_type limit = limit_type::none; // limit that aborted the match
     operator bool() { return type == match_type::full; }
   };
 
+  // piece of a segmented input, e.g. one buffer of a scatter-gather list
+  struct segment
+  {
+    const char *data;
+    size_t length;
+  };
+
+  // Input that is matched in place. The characters stay with the caller and
+  // have to outlive the match; positions in the results are offsets into
+  // them. Besides std::string, C strings, pointer and length, types with
+  // data() and size() like string views and std::vector<char>, and ranges
+  // of char pointers or of iterators of std::string and std::vector<char>
+  // are accepted. Ranges of other iterators do not compile, as their
+  // characters need not be contiguous.
+  // Input may also be a sequence of segments, read as if they were
+  // concatenated; matches and captures may cross their boundaries and
+  // data() is null. A segmented text remembers the segment read last and
+  // must not be matched by several threads at once.
+  class text
+  {
+    // iterators over contiguous characters
+    template <typename iterator>
+    struct contiguous_iterator : std::integral_constant<bool,
+      std::is_same<iterator, char*>::value
+      || std::is_same<iterator, const char*>::value
+      || std::is_same<iterator, std::string::iterator>::value
+      || std::is_same<iterator, std::string::const_iterator>::value
+      || std::is_same<iterator, std::vector<char>::iterator>::value
+      || std::is_same<iterator, std::vector<char>::const_iterator>::value> {};
+
+  public:
+    text(const char *str) : text(str, std::char_traits<char>::length(str)) {}
+    text(const char *data, size_t length)
+      : ptr(data), len(length), window(data), window_begin(0), window_length(length) {}
+    text(const std::string &str) : text(str.data(), str.length()) {}
+    template <typename string_type,
+              typename = typename std::enable_if<std::is_convertible<
+                decltype(std::declval<const string_type&>().data()),
+                const char*>::value>::type>
+    text(const string_type &str) : text(str.data(), str.size()) {}
+    template <typename iterator,
+              typename = typename std::enable_if<contiguous_iterator<iterator>::value>::type>
+    text(iterator begin, iterator end)
+      : text(begin == end ? nullptr : &*begin, end - begin) {}
+    text(const segment *segments, size_t count);
+    text(const std::vector<segment> &segments)
+      : text(segments.data(), segments.size()) {}
+
+    const char *data() const { return ptr; }
+    size_t length() const { return len; }
+    size_t size() const { return len; }
+    bool contiguous() const { return segments.empty(); }
+    // like std::string, the end reads as '\0'
+    char operator[](size_t pos) const
+    {
+      if(pos - window_begin < window_length)
+        return window[pos - window_begin];
+      return locate(pos);
+    }
+    std::string substr(size_t pos, size_t n = std::string::npos) const;
+
+  private:
+    friend class qre;
+
+    char locate(size_t pos) const;
+    void append_to(std::string &out, size_t pos, size_t n) const;
+
+    const char *ptr;
+    size_t len;
+    // segments with their offsets, empty if contiguous
+    std::vector<std::pair<size_t, segment>> segments;
+    // segment read last
+    mutable const char *window;
+    mutable size_t window_begin;
+    mutable size_t window_length;
+  };
+
+  // Limits of a single match. The backtracker gives up with
+  // match_type::aborted when it exceeds one. The automaton engines run in
+  // linear time and are not limited.
+  struct match_limits
+  {
+    uint64_t max_steps = 0; // backtracking steps, 0 for no limit
+    uint64_t max_memory = 0; // bytes of backtracking history, 0 for no limit
+    std::chrono::steady_clock::time_point deadline
+      = std::chrono::steady_clock::time_point::max();
+    const std::atomic<bool> *cancel = nullptr; // abort once set
+  };
+
+  // engine that produced the result of a match
+  enum class engine_type : uint8_t
+  { none, // rejected without running an engine
+    literal, // search for a literal pattern
+    onepass, // one-pass matcher
+    automaton, // DFA scans only
+    automaton_backtrack, // DFA scans for the bounds, backtracking for captures
+    backtrack }; // backtracking only
+
+  // counters of a single match, filled in on request
+  struct match_stats
+  {
+    engine_type engine = engine_type::none;
+    uint64_t transitions = 0; // transitions tried by the backtracker
+    uint64_t checks_failed = 0; // transitions whose test failed
+    uint64_t backtracks = 0; // steps back in the history
+    uint64_t start_positions = 0; // positions the backtracker started at
+    uint64_t max_history = 0; // maximum depth of the backtracking history
+    uint64_t dfa_states = 0; // DFA states built during the match
+    uint64_t bytes_allocated = 0; // by the history and the DFA states
+  };
+
+  // worst case running time of the backtracker in the length of the input
+  enum class complexity_type { linear, polynomial, exponential, unknown };
+
+  struct complexity_t
+  {
+    complexity_type type = complexity_type::linear;
+    unsigned int degree = 1; // of polynomial running time
+    bool backtracking = true; // false if a linear time engine is used instead
+    // slow input that is not matched: prefix followed by pump repeated any
+    // number of times and suffix
+    std::string prefix, pump, suffix;
+  };
+
   qre();
-  qre(const std::string &regex); // contruct a regular expression
+  qre(const std::string &regex,
+      compile_flag flags = compile_flag::none); // contruct a regular expression
   qre(const qre &q);
   qre(qre &&q);
   qre &operator=(const qre &p);
   qre &operator=(qre &&p);
   ~qre();
-  bool operator()(const std::string &str, match &result,
-                  match_flag flags = match_flag::none) const; // matching function
+  bool operator()(const text &str, match &result,
+                  match_flag flags = match_flag::none,
+                  match_stats *stats = nullptr,
+                  const match_limits *limits = nullptr) const; // matching function
+  // position and length of a match
+  struct span_t
+  {
+    bool found = false;
+    size_t pos = 0;
+    size_t length = 0;
+  };
+
+  // These only locate matches. Neither captures nor the matched string are
+  // extracted, so the fastest engine for the pattern can always be used.
+  // The literal search, the one-pass matcher and the automaton allocate
+  // nothing once the DFA caches are built; the backtracker still keeps its
+  // history on the heap, unless it runs as machine code with a short one.
+  bool test(const text &str, match_flag flags = match_flag::none) const;
+  span_t find_pos(const text &str, match_flag flags = match_flag::none) const;
+  // number of non-overlapping matches, each search starting at the end of
+  // the previous match, or one character later after an empty match; with
+  // fix_left only the match at the beginning counts
+  size_t count(const text &str, match_flag flags = match_flag::none) const;
+
+  // static analysis of the pattern for the given flags
+  complexity_t complexity(match_flag flags = match_flag::none) const;
+  // C++ source of a function 'name' that matches like operator() without
+  // the library, for input in bytes with fix_left, fix_right and multiline;
+  // throws std::runtime_error for patterns with backreferences
+  std::string generate(const std::string &name) const;
+  // Use only the given engine for testing. engine_type::none restores the
+  // automatic selection. Matches throw std::runtime_error if the engine
+  // cannot handle the pattern with the given flags.
+  void use_engine(engine_type engine);
 
 private:
 
   // UTF-8 handling -----------------------------------------------------------
 
-  static char32_t advance(const std::string &str, unsigned int &pos);
-  static char32_t peek(const std::string &str, unsigned int pos);
-  static char32_t peek_prev(const std::string &str, unsigned int pos);
+  enum class utf8_status { invalid, ascii, valid };
+
+  static utf8_status validate_utf8(const text &str);
+  // validates UTF-8 input and drops the UTF-8 mode if it is plain ASCII
+  static match_flag input_flags(const text &str, match_flag flags);
+  static char32_t advance(const text &str, size_t &pos);
+  static char32_t peek(const text &str, size_t pos);
+  static char32_t peek_prev(const text &str, size_t pos);
   std::u32string utf8toutf32(const std::string &str) const;
   std::string utf32toutf8(char32_t ch) const;
   std::string utf32toutf8(const std::u32string &str) const;
@@ -90,6 +268,9 @@ private:
     bool operator<(const char_range &r) const; // for std::set
   };
 
+  // sorted list of disjoint, non-adjacent character ranges
+  typedef std::vector<char_range> charset_t;
+
   // Tests --------------------------------------------------------------------
 
   struct test_t
@@ -104,12 +285,62 @@ private:
     std::vector<test_t> subtractions;
     std::vector<test_t> intersections;
     std::pair<capture_t, signed int> backref;
+    bool icase = false; // backreference ignores case
+    uint32_t categories = 0; // set of general categories as bit mask
   };
 
-  bool check(const test_t &test, const std::string &str,
-             unsigned int &pos, bool multiline, bool utf8,
+  bool check(const test_t &test, const text &str,
+             size_t &pos, bool multiline, bool utf8,
              match &match_sofar) const;
 
+  // character sets -----------------------------------------------------------
+
+  static const char32_t max_char = 0x10FFFF;
+
+  static charset_t charset_normalise(charset_t set);
+  static charset_t charset_union(const charset_t &a, const charset_t &b);
+  static charset_t charset_invert(const charset_t &a);
+  static charset_t charset_intersect(const charset_t &a, const charset_t &b);
+  static bool charset_disjoint(const charset_t &a, const charset_t &b);
+  // set of characters a single character test can consume
+  static charset_t charset(const test_t &test, bool multiline);
+
+  // case folding -------------------------------------------------------------
+
+  // Pairs of characters that are equal when ignoring case, after the simple
+  // case foldings of the Unicode character database. Either each character
+  // in [begin, end] pairs with the one 'delta' positions after it, or the
+  // characters in [begin, end] pair up alternately (delta == 0). Generated
+  // by tools/gen_casepairs.py.
+  struct case_pairs_t
+  {
+    char32_t begin;
+    char32_t end;
+    char32_t delta;
+  };
+  static const case_pairs_t case_pairs[];
+  static const unsigned int num_case_pairs;
+
+  // adds all characters that are equal when ignoring case
+  static charset_t charset_fold(const charset_t &set);
+  // representative of all characters that are equal when ignoring case
+  static char32_t fold(char32_t ch);
+  // make a test ignore case
+  static void fold_test(test_t &test);
+
+  // Unicode properties -------------------------------------------------------
+
+  enum class general_category : uint8_t
+  { Cc, Cf, Cn, Co, Cs, Ll, Lm, Lo, Lt, Lu, Mc, Me, Mn, Nd, Nl, No, Pc, Pd, Pe,
+    Pf, Pi, Po, Ps, Sc, Sk, Sm, So, Zl, Zp, Zs };
+
+  static general_category category(char32_t ch);
+  // all characters in a set of general categories
+  static charset_t category_charset(uint32_t categories);
+  // reads "\d", "\w", "\s", "\p{...}" and their negations
+  static bool read_property(const std::u32string &str, unsigned int &pos,
+                            test_t &test);
+
   // tokenizer -------------------------------------------------------------------
 
   struct range_t
@@ -119,66 +350,91 @@ private:
     bool infinite = false;
   };
 
+  static const unsigned int no_test = ~0u;
+
+  // Symbols are plain values, so that tokens can be collected without heap
+  // allocations. Single characters are stored in place, all other tests and
+  // group names in pools next to the symbols.
   struct symbol
   {
     enum class type_t
     { test, range, qmark, star, plus, alt, lparan, rparan };
     type_t type;
-    test_t test;
+    char32_t ch = 0; // character to match unless 'test' is set
+    unsigned int test = no_test; // index into tokens_t::tests
     range_t range;
-    std::string name;
+    unsigned int name = 0; // index into tokens_t::names
     bool capture = true;
     bool atomic = false;
     bool named = false;
+    bool icase = false; // character ignores case
+  };
+
+  struct tokens_t
+  {
+    std::vector<symbol> syms;
+    std::vector<test_t> tests;
+    std::vector<std::string> names;
   };
 
   // regexp parse functions
   test_t read_char_class(const std::u32string &str, unsigned int &pos, bool leading_backet = true) const;
   bool read_range(const std::u32string &str, unsigned int &pos, range_t &r) const;
   std::pair<capture_t, signed int> read_backref(const std::u32string &str, unsigned int &pos) const;
-  std::u32string read_cg_name(const std::u32string str, unsigned int &pos) const;
-  std::list<symbol> tokeniser(const std::u32string &str) const;
+  std::u32string read_cg_name(const std::u32string &str, unsigned int &pos) const;
+  tokens_t tokeniser(const std::u32string &str, bool icase) const;
+  // test of a symbol of type test
+  static test_t symbol_test(const tokens_t &tokens, const symbol &sym);
 
   // state machine ------------------------------------------------------------
 
-  struct state_t;
+  // States live in a per-pattern arena and refer to each other by index.
+
+  static const unsigned int no_state = ~0u;
 
   struct transition_t
   {
     test_t test;
-    std::shared_ptr<state_t> state;
+    unsigned int state; // index of the target state
   };
 
   struct state_t
   {
+    unsigned int id = 0; // index into 'states'
     bool begin_capture = false;
     bool nonstop = false; // keep backtracking
     std::vector<capture_t> captures; // list of active capture groups
     std::vector<transition_t> transitions;
-    std::vector<std::weak_ptr<state_t> > prev;
+    unsigned int loop = no_state; // index into 'loops' of a loop head or body
   };
 
+  // state arena, only the reachable states in depth-first order after
+  // compilation
+  std::vector<state_t> states;
+
+  // new state in the arena
+  unsigned int new_state();
+
   // espiloin transition
-  void epsilon(std::shared_ptr<state_t> a, std::shared_ptr<state_t> b) const;
+  void epsilon(unsigned int a, unsigned int b);
 
   // merges contents of src into contents of dst
-  void merge_state(std::shared_ptr<state_t> &dst,
-                   std::shared_ptr<state_t> &src) const;
+  void merge_state(unsigned int dst, unsigned int src);
 
   // state chain
   struct chain_t
   {
-    std::shared_ptr<state_t> begin;
-    std::shared_ptr<state_t> end;
+    unsigned int begin = no_state;
+    unsigned int end = no_state;
 
     operator bool()
     {
-      return begin && end;
+      return begin != no_state && end != no_state;
     }
   };
 
-  // clone a state chain
-  static chain_t clone(chain_t chain);
+  // clone a state chain within the arena
+  chain_t clone(chain_t chain);
 
   // parser -------------------------------------------------------------------
 
@@ -186,16 +442,334 @@ private:
   std::vector<capture_t> captures; // list of active capture groups
   bool nonstop = false; // keep backtracking in atomic groups
 
-  chain_t parse_atom(std::list<symbol> &syms);
-  chain_t parse_factor(std::list<symbol> &syms);
-  chain_t parse_term(std::list<symbol> &syms);
-  chain_t parse_expression(std::list<symbol> &syms);
+  // Groups are kept on an explicit stack, so that the nesting depth is not
+  // limited by the call stack.
+  chain_t parse(const tokens_t &tokens);
+  chain_t parse_test(const tokens_t &tokens, const symbol &sym);
+  // applies the quantifier following 'pos' to an atom
+  chain_t parse_factor(chain_t atom, const tokens_t &tokens, unsigned int &pos);
+
+  // Alternations of literal strings become a trie of states, so that at most
+  // one branch proceeds on any character. Returns an empty chain and leaves
+  // 'pos' alone if the alternation is not of that form.
+  chain_t parse_literals(const tokens_t &tokens, unsigned int &pos);
 
   chain_t the_chain;
+
+  // compilation --------------------------------------------------------------
+
+  // drop unreachable states and prepare the matching engines
+  void compile();
+
+  // one-pass engine ----------------------------------------------------------
+
+  // A pattern is one-pass if from every state at most one path of epsilon
+  // transitions followed by a single consuming transition can proceed on a
+  // given character. Such patterns can be fully matched without backtracking.
+
+  struct onepass_leaf_t
+  {
+    std::vector<const state_t*> path; // states left on the way
+    std::vector<const test_t*> asserts; // zero-width tests on the way
+    const test_t *test = nullptr; // consuming test, nullptr if accepting
+    unsigned int target = 0; // state after the consuming test
+  };
+
+  std::vector<std::vector<onepass_leaf_t>> onepass; // empty if not one-pass
+  bool onepass_eol = false; // pattern contains end of line tests
+
+  void onepass_compile();
+  // records the captures and the matched string only if 'capture' is set
+  bool onepass_match(const text &str, match &result,
+                     bool multiline, bool utf8, bool capture) const;
+
+  // character class runs -----------------------------------------------------
+
+  // Runs of bytes of one class are skipped 16 or 32 at a time where the CPU
+  // has SSSE3 or AVX2. A byte is looked up by its low nibble in a table of
+  // rows, whose bits stand for the high nibbles.
+
+  struct byte_class_t
+  {
+    uint8_t low[16]; // bytes below 0x80
+    uint8_t high[16]; // bytes from 0x80 on
+  };
+
+  static byte_class_t byte_class(const std::vector<bool> &bytes);
+  static bool byte_class_has(const byte_class_t &c, uint8_t ch)
+  {
+    return ((ch & 0x80) ? c.high : c.low)[ch & 0x0F] & (1 << ((ch >> 4) & 7));
+  }
+  // number of class bytes at the beginning or the end of data
+  static size_t class_run(const byte_class_t &c, const uint8_t *data, size_t n);
+  static size_t class_run_reverse(const byte_class_t &c, const uint8_t *data, size_t n);
+
+  // automaton engine ---------------------------------------------------------
+
+  // Patterns without backreferences, atomic groups and "\R" are translated
+  // into an NFA over bytes, which is lazily turned into a DFA. In UTF-8 mode
+  // character ranges become sequences of byte ranges, so that the input is
+  // never decoded. A forward scan finds the end of the leftmost match and a
+  // scan of the reversed automaton from there finds its beginning.
+
+  struct nfa_t
+  {
+    struct edge_t
+    {
+      enum class type_t { epsilon, bol, bol_multiline, eol, range };
+      type_t type;
+      uint8_t begin;
+      uint8_t end;
+      unsigned int target;
+    };
+
+    std::vector<edge_t> edges; // grouped by node, ordered by priority
+    std::vector<unsigned int> offsets; // first edge per node, then the end
+    unsigned int start = 0;
+    unsigned int accept = 0;
+    bool assertions = false; // contains zero-width tests
+
+    unsigned int size() const { return offsets.size()-1; }
+    void assign(const std::vector<std::vector<edge_t>> &nodes);
+  };
+
+  // position dependent information for zero-width tests
+  enum dfa_context : uint8_t { at_begin = 1, after_newline = 2, at_end = 4 };
+
+  struct dfa_t
+  {
+    struct kernel_t
+    {
+      std::vector<unsigned int> nodes; // NFA nodes ordered by priority
+      signed int variants[8]; // state per context
+    };
+
+    struct dstate_t
+    {
+      unsigned int kernel;
+      uint8_t context;
+      bool accepting = false;
+      std::vector<unsigned int> threads; // consuming NFA edges by priority
+      signed char run = -1; // stays on the bytes of run_class, -1 if unknown
+      byte_class_t run_class;
+    };
+
+    const nfa_t *nfa = nullptr;
+    bool cut = false; // leftmost-first: discard threads after a match
+    std::vector<kernel_t> kernels;
+    std::map<std::vector<unsigned int>, unsigned int> kernel_index;
+    std::vector<dstate_t> states;
+    std::vector<signed int> next; // last successor per state and byte
+    std::vector<signed int> starts; // per anchoring and context, -1 if unknown
+    std::mutex mutex;
+  };
+
+  static const unsigned int dfa_max_states = 4096;
+  // transitions of a state to itself in a row before the rest of the run
+  // is scanned at once
+  static const unsigned int dfa_run_after = 8;
+
+  bool automaton = false; // pattern can be matched by the automaton engine
+  bool capturing = false; // pattern contains capture groups
+  nfa_t nfa[2][2]; // per multiline and UTF-8 mode
+  nfa_t nfa_reverse[2][2];
+  std::shared_ptr<dfa_t> dfa_first[2][2]; // leftmost-first forward scan
+  std::shared_ptr<dfa_t> dfa_all[2][2]; // forward scan without priorities
+  std::shared_ptr<dfa_t> dfa_reverse[2][2];
+
+  static std::vector<std::vector<char_range>> utf8_sequences(char_range range);
+  void nfa_compile();
+  // points the automata at the NFAs of this object after these have been
+  // copied or moved in, with new empty caches if 'fresh' is set
+  void dfa_attach(bool fresh);
+  static uint8_t dfa_context_at(const text &str, size_t pos);
+  static unsigned int dfa_state(dfa_t &dfa, const std::vector<unsigned int> &kernel,
+                                uint8_t context);
+  static unsigned int dfa_next(dfa_t &dfa, unsigned int state, uint8_t ch,
+                               uint8_t context);
+  // state a scan starts in, from the start node if 'anchored' is set
+  static unsigned int dfa_start(dfa_t &dfa, bool anchored, uint8_t context);
+  // bytes from 'pos' on, or before it if 'reverse' is set, that leave
+  // state 's' unchanged, not beyond 'limit'
+  static size_t dfa_run(dfa_t &dfa, unsigned int s, const text &str,
+                        size_t pos, size_t limit, bool reverse);
+  static bool dfa_scan(dfa_t &dfa, const text &str, size_t begin,
+                       bool anchored, bool fix_right, size_t &end);
+  // scans back from 'end', but not beyond 'start'
+  static bool dfa_scan_reverse(dfa_t &dfa, const text &str,
+                               size_t start, size_t end,
+                               bool anchored, size_t &begin);
+  // runs 'scan' on the cache 'dfa', or on a temporary one while another
+  // match uses it, and counts the states built into 'stats'
+  template <typename function>
+  static bool dfa_use(const std::shared_ptr<dfa_t> &dfa, match_stats *stats,
+                      function scan);
+  // bounds of the match starting at 'start' or later
+  bool automaton_match(const text &str, bool fix_left,
+                       bool fix_right, bool longest, bool multiline,
+                       bool utf8, size_t start, match_stats *stats,
+                       size_t &begin, size_t &end) const;
+
+  // literal prefilter --------------------------------------------------------
+
+  // Searches skip ahead to the first occurrence of the ASCII literal every
+  // match begins with. Letters of case-insensitive literals match either case.
+
+  std::string prefix[2]; // per UTF-8 mode, letters in lower case
+  std::string prefix_mask[2]; // 0x20 for letters of either case, else 0
+
+  void prefilter_compile();
+  // finds the next occurrence of the prefix at or after 'pos'
+  bool prefilter(const text &str, bool utf8, size_t &pos) const;
+
+  // backtracking engine ------------------------------------------------------
+
+  static const size_t no_end = ~static_cast<size_t>(0); // match may end anywhere
+
+  // deadline and cancellation are checked every so many steps
+  static const uint64_t limit_interval = 1024;
+
+  // match starting at 'begin' (or later in search mode) and ending at 'end',
+  // counting into 'stats' only if 'collect' is set and recording captures
+  // and the matched string only if 'capture' is set; the end of the match is
+  // stored in 'match_end'
+  template <bool collect, bool capture>
+  bool backtrack(const text &str, match &result, match_flag flags,
+                 size_t begin, size_t end, match_stats *stats,
+                 const match_limits *limits,
+                 size_t *match_end = nullptr) const;
+  // the same with positions of type 'offset_t' in the history
+  template <bool collect, bool capture, typename offset_t>
+  bool backtrack(const text &str, match &result, match_flag flags,
+                 size_t begin, size_t end, match_stats *stats,
+                 const match_limits *limits, size_t *match_end) const;
+
+  // A greedy loop over a single character test, like ".*" or "[^,]+",
+  // consumes its whole run in one step. Only the loop head and the position
+  // reached are kept in the history, and backtracking gives back one
+  // character at a time from there instead of unwinding a frame per
+  // character and epsilon transition.
+  // Loops that nothing after them can continue from are possessive, and
+  // their frames give back the whole run at once.
+
+  struct loop_t
+  {
+    unsigned int head; // state choosing between the body and the exit
+    unsigned int body; // state with the test
+    unsigned int exit;
+    const test_t *test;
+    byte_class_t bytes[2]; // per multiline mode, bytes the test consumes
+    byte_class_t ascii[2]; // the same, below 0x80 only, for UTF-8 input
+    bool possessive[2]; // per multiline mode, giving back cannot succeed
+  };
+
+  std::vector<loop_t> loops;
+
+  void loop_compile();
+  // whether no character of 'set' can follow the loop, so that it never
+  // gives back characters, like "[a-z]++:" instead of "[a-z]+:"
+  bool loop_possessive(unsigned int exit, const charset_t &set, bool multiline) const;
+  // end of the run of characters from 'pos' on the loop consumes, not
+  // beyond 'limit'
+  size_t loop_run(const loop_t &loop, const text &str, size_t pos, size_t limit,
+                  bool multiline, bool utf8, match &match_sofar) const;
+
+  // JIT engine ---------------------------------------------------------------
+
+  // With compile_flag::jit the states are translated into x86-64 machine code
+  // on Linux, which runs the backtracking searches that record no captures:
+  // states become labels, single character tests become compare or bit test
+  // sequences, and the history is an array of resume addresses and
+  // positions. Backreferences, UTF-8 and segmented input, statistics and
+  // limits are left to the interpreter. Building with QRE_JIT_DEFAULT
+  // compiles every pattern, and QRE_JIT_VERIFY compares each result with the
+  // interpreter.
+
+  struct jit_frame
+  {
+    const void *resume; // code trying the next transition
+    size_t pos;
+  };
+  // match at 'pos' only, returns its end, jit_no_match or jit_overflow
+  typedef size_t (*jit_function)(const uint8_t *data, size_t length, size_t pos,
+                                 jit_frame *stack, jit_frame *stack_end);
+  static const size_t jit_no_match = ~static_cast<size_t>(0);
+  static const size_t jit_overflow = jit_no_match - 1;
+
+  struct jit_code_t; // executable pages
+  bool jit = false; // compiled with compile_flag::jit
+  std::shared_ptr<jit_code_t> jit_code;
+  jit_function jit_entry[2][2] = { { nullptr, nullptr }, { nullptr, nullptr } }; // per multiline and fix_right
+
+  void jit_compile();
+  bool jit_usable(const text &str, match_flag flags) const;
+  // leftmost match at 'begin' or later, like backtrack<false, false>
+  bool jit_search(const text &str, match_flag flags, size_t begin,
+                  size_t &match_begin, size_t &match_end) const;
+
+  // engine selection ---------------------------------------------------------
+
+  // Every match runs the cheapest engine that is correct for the pattern and
+  // the flags of the call: a literal search for plain ASCII literals, the
+  // one-pass matcher for anchored full matches, the automaton if no captures
+  // are needed, and the backtracker otherwise. With captures on longer inputs
+  // the automaton first finds the bounds of the match, so that the
+  // backtracker is run only once and only on the match. Patterns the
+  // automaton cannot handle are searched by the backtracker without captures
+  // first, unless backreferences need them.
+
+  // input length from which captures are located by the automaton first
+  static const unsigned int automaton_threshold = 16;
+
+  engine_type forced = engine_type::none; // set by use_engine()
+  bool literal[2] = { false, false }; // per UTF-8 mode, pattern is the prefix
+  unsigned int min_length = 0; // minimum number of bytes of a match
+  bool backreferences = false; // pattern contains backreferences
+  // every capture group, each has an entry in match::sub or match::named_sub
+  // whether it took part in the match or not
+  std::vector<capture_t> capture_groups;
+
+  void engine_compile();
+  engine_type select(match_flag flags, size_t length,
+                     bool captures = true) const;
+  // matching function without the entries of groups that were never entered
+  bool run(const text &str, match &result, match_flag flags,
+           match_stats *stats, const match_limits *limits) const;
+  // position of the literal at 'start' or, in search mode, after it
+  bool literal_match(const text &str, bool fix_left, bool fix_right,
+                     bool utf8, size_t start, size_t &pos) const;
+  // bounds of the first match at 'start' or later for test(), find_pos()
+  // and count(), flags already checked by input_flags()
+  bool find(const text &str, match_flag flags, size_t start,
+            size_t &begin, size_t &end) const;
+
+  // complexity analysis ------------------------------------------------------
+
+  struct complexity_graph;
+
+  // counted repetitions up to this bound are analysed as they are
+  static const uint32_t loop_bound = 8;
+
+  std::string source; // the regular expression
+  bool icase = false; // compiled with compile_flag::icase
+
+  complexity_t analyse(match_flag flags) const;
+
+  // longest match ------------------------------------------------------------
+
+  static const unsigned int infinite_length = ~0u;
+
+  // maximum number of bytes consumed on the way from a state to the end
+  std::vector<unsigned int> max_length;
+
+  void longest_compile();
 };
 
-// make match_flag behave like a normal enumeration
+// make match_flag and compile_flag behave like normal enumerations
 qre::match_flag operator|(const qre::match_flag &f1, const qre::match_flag &f2);
 qre::match_flag operator&(const qre::match_flag &f1, const qre::match_flag &f2);
+qre::match_flag operator~(const qre::match_flag &f);
+qre::compile_flag operator|(const qre::compile_flag &f1, const qre::compile_flag &f2);
+qre::compile_flag operator&(const qre::compile_flag &f1, const qre::compile_flag &f2);
 
 #endif // QRE_HPP
@@ -0,0 +1,128 @@
+/*
+ * Copyright 2016 Nils Christopher Brause
+ *
+ * This file is part of libqre.
+ *
+ * libqre is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libqre is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libqre.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Regular expression compiler. "qrec [-o out.hpp] rules" writes a header
+// with one matcher function per rule, which needs nothing of the library at
+// run time but the declaration of qre::match.
+//
+// Every line of the rules file holds a function name and the pattern,
+// separated by whitespace. A name ending in "/i" ignores case. Empty lines
+// and lines beginning with '#' are skipped.
+
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <qre.hpp>
+
+int main(int argc, char **argv)
+{
+  std::string input, output;
+  for(int c = 1; c < argc; c++)
+    {
+      std::string arg = argv[c];
+      if(arg == "-o" && c+1 < argc)
+        output = argv[++c];
+      else if(input.empty())
+        input = arg;
+      else
+        input.clear(), c = argc;
+    }
+  if(input.empty())
+    {
+      std::cerr << "usage: " << argv[0] << " [-o out.hpp] rules" << std::endl;
+      return 2;
+    }
+
+  std::ifstream rules(input);
+  if(!rules)
+    {
+      std::cerr << input << ": cannot open" << std::endl;
+      return 1;
+    }
+
+  // include guard from the output file name
+  std::string guard = "QRE_GENERATED";
+  if(!output.empty())
+    {
+      guard.clear();
+      for(char ch : output.substr(output.find_last_of('/') + 1))
+        guard += std::isalnum(static_cast<unsigned char>(ch))
+          ? std::toupper(static_cast<unsigned char>(ch)) : '_';
+    }
+
+  std::ostringstream out;
+  out << "// generated by qrec from " << input << ", do not edit\n\n"
+      << "#ifndef " << guard << "\n"
+      << "#define " << guard << "\n\n";
+
+  std::string line;
+  unsigned int number = 0;
+  while(std::getline(rules, line))
+    {
+      number++;
+      size_t begin = line.find_first_not_of(" \t");
+      if(begin == std::string::npos || line[begin] == '#')
+        continue;
+      size_t end = line.find_first_of(" \t", begin);
+      size_t pattern = end == std::string::npos
+        ? std::string::npos : line.find_first_not_of(" \t", end);
+      if(pattern == std::string::npos)
+        {
+          std::cerr << input << ":" << number << ": missing pattern" << std::endl;
+          return 1;
+        }
+
+      std::string name = line.substr(begin, end - begin);
+      qre::compile_flag flags = qre::compile_flag::none;
+      if(name.size() > 2 && name.compare(name.size() - 2, 2, "/i") == 0)
+        {
+          name.erase(name.size() - 2);
+          flags = qre::compile_flag::icase;
+        }
+
+      try
+        {
+          qre re(line.substr(pattern), flags);
+          out << re.generate(name) << "\n";
+        }
+      catch(std::exception &e)
+        {
+          std::cerr << input << ":" << number << ": " << e.what() << std::endl;
+          return 1;
+        }
+    }
+
+  out << "#endif // " << guard << "\n";
+
+  if(output.empty())
+    std::cout << out.str();
+  else
+    {
+      std::ofstream file(output);
+      file << out.str();
+      if(!file)
+        {
+          std::cerr << output << ": cannot write" << std::endl;
+          return 1;
+        }
+    }
+  return 0;
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2016 Nils Christopher Brause
+ *
+ * This file is part of libqre.
+ *
+ * libqre is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libqre is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libqre.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Compares the matchers generated from qrec_test.rules with the library.
+// Build and run with "scons qrectest".
+
+#include <iostream>
+#include <qre.hpp>
+#include "qrec_test.hpp"
+
+typedef bool (*generated_t)(const std::string&, qre::match&, qre::match_flag);
+
+static bool same(const qre::match &a, const qre::match &b)
+{
+  if(a.type != b.type)
+    return false;
+  if(a.type != qre::match_type::full)
+    return true;
+  return a.pos == b.pos && a.str == b.str
+    && a.sub == b.sub && a.named_sub == b.named_sub;
+}
+
+int main()
+{
+#define RULE(name) { qre_generated::name::source, qre_generated::name::flags, name }
+  struct
+  {
+    const char *source;
+    qre::compile_flag flags;
+    generated_t generated;
+  } rules[] =
+      {
+        RULE(word), RULE(digits), RULE(date), RULE(alternation),
+        RULE(anchors), RULE(line), RULE(newlines), RULE(lazy),
+        RULE(nested), RULE(keyword), RULE(negated), RULE(email),
+        RULE(empty), RULE(counted), RULE(optional)
+      };
+#undef RULE
+
+  const std::string inputs[] =
+    {
+      "", "abc", "x 12.5 y 7", "on 2016-04-01 and 2017-12-31",
+      "foobarbarx foox", "ab\ncd\n", "\nab\r\ncd", "a\r\nb a\nb a\rb",
+      "<a><bc>", "aabcbc", "say HELLO   World!", "rhythm and blues",
+      "mail a.b@host.org now", "xxx", "abababab", "\xff\x80 abc"
+    };
+
+  const qre::match_flag modes[] =
+    {
+      qre::match_flag::none,
+      qre::match_flag::fix_left,
+      qre::match_flag::fix_right,
+      qre::match_flag::fix_left | qre::match_flag::fix_right,
+      qre::match_flag::multiline,
+      qre::match_flag::multiline | qre::match_flag::fix_right
+    };
+
+  unsigned int failures = 0;
+  unsigned int checks = 0;
+  for(auto &rule : rules)
+    {
+      qre re(rule.source, rule.flags);
+      for(auto &input : inputs)
+        for(auto mode : modes)
+          {
+            qre::match expected, generated;
+            re(input, expected, mode);
+            rule.generated(input, generated, mode);
+            checks++;
+            if(!same(expected, generated))
+              {
+                failures++;
+                std::cerr << "mismatch: /" << rule.source << "/ on \""
+                          << input << "\" with flags "
+                          << static_cast<unsigned int>(mode) << ": \""
+                          << expected.str << "\" at " << expected.pos << ", got \""
+                          << generated.str << "\" at " << generated.pos << std::endl;
+              }
+          }
+    }
+
+  std::cout << checks << " checks, " << failures << " failures" << std::endl;
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2016 Nils Christopher Brause
+ *
+ * This file is part of libqre.
+ *
+ * libqre is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libqre is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libqre.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <qre.hpp>
+#include <algorithm>
+
+qre::charset_t qre::charset_fold(const charset_t &set)
+{
+  charset_t result = set;
+  while(true)
+    {
+      // characters of other case
+      charset_t added;
+      for(unsigned int c = 0; c < num_case_pairs; c++)
+        {
+          const case_pairs_t &pairs = case_pairs[c];
+          for(auto &r : result)
+            if(pairs.delta)
+              {
+                // first to second character
+                char32_t begin = std::max<char32_t>(r.begin, pairs.begin);
+                char32_t end = std::min<char32_t>(r.end, pairs.end);
+                if(begin <= end)
+                  added.push_back({ begin + pairs.delta, end + pairs.delta });
+
+                // second to first character
+                begin = std::max<char32_t>(r.begin, pairs.begin + pairs.delta);
+                end = std::min<char32_t>(r.end, pairs.end + pairs.delta);
+                if(begin <= end)
+                  added.push_back({ begin - pairs.delta, end - pairs.delta });
+              }
+            else
+              {
+                char32_t begin = std::max<char32_t>(r.begin, pairs.begin);
+                char32_t end = std::min<char32_t>(r.end, pairs.end);
+                if(begin <= end)
+                  for(char32_t ch = begin; ch <= end; ch++)
+                    {
+                      char32_t other = (ch - pairs.begin) % 2 ? ch - 1 : ch + 1;
+                      added.push_back({ other, other });
+                    }
+              }
+        }
+
+      // repeat for characters with more than two cases
+      charset_t merged = charset_union(result, charset_normalise(added));
+      if(merged == result)
+        return result;
+      result = merged;
+    }
+}
+
+char32_t qre::fold(char32_t ch)
+{
+  // ASCII letters have the smallest code point of their case
+  if(ch < 0x80)
+    return 'a' <= ch && ch <= 'z' ? ch - 32 : ch;
+
+  // the smallest character of equal case
+  return charset_fold({ { ch, ch } }).front().begin;
+}
+
+void qre::fold_test(test_t &test)
+{
+  switch(test.type)
+    {
+    case test_t::test_type::character:
+      {
+        charset_t set;
+        for(auto &c : test.chars)
+          set.push_back({ c, c });
+        set.insert(set.end(), test.ranges.begin(), test.ranges.end());
+        set = charset_fold(charset_normalise(set));
+
+        test.chars.clear();
+        test.ranges.clear();
+        for(auto &r : set)
+          if(r.begin == r.end)
+            test.chars.insert(r.begin);
+          else
+            test.ranges.insert(r);
+
+        for(auto &sub : test.subtractions)
+          fold_test(sub);
+        for(auto &itr : test.intersections)
+          fold_test(itr);
+      }
+      break;
+
+    case test_t::test_type::backref:
+      test.icase = true;
+      break;
+
+    default:
+      break;
+    }
+}
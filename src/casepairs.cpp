@@ -0,0 +1,98 @@
+/*
+ * Copyright 2016 Nils Christopher Brause
+ *
+ * This file is part of libqre.
+ *
+ * libqre is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libqre is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libqre.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// generated by tools/gen_casepairs.py from Unicode 14.0.0
+
+#include <qre.hpp>
+
+const qre::case_pairs_t qre::case_pairs[] =
+  {
+    { 0x00041, 0x0005A,    32 }, { 0x0006B, 0x0006B,  8383 }, { 0x00073, 0x00073,   268 },
+    { 0x000B5, 0x000B5,   775 }, { 0x000C0, 0x000D6,    32 }, { 0x000D8, 0x000DE,    32 },
+    { 0x000DF, 0x000DF,  7615 }, { 0x000E5, 0x000E5,  8262 }, { 0x000FF, 0x000FF,   121 },
+    { 0x00100, 0x0012F,     0 }, { 0x00132, 0x00137,     0 }, { 0x00139, 0x00148,     0 },
+    { 0x0014A, 0x00177,     0 }, { 0x00179, 0x0017E,     0 }, { 0x00180, 0x00180,   195 },
+    { 0x00181, 0x00181,   210 }, { 0x00182, 0x00185,     0 }, { 0x00186, 0x00186,   206 },
+    { 0x00187, 0x00187,     1 }, { 0x00189, 0x0018A,   205 }, { 0x0018B, 0x0018B,     1 },
+    { 0x0018E, 0x0018E,    79 }, { 0x0018F, 0x0018F,   202 }, { 0x00190, 0x00190,   203 },
+    { 0x00191, 0x00191,     1 }, { 0x00193, 0x00193,   205 }, { 0x00194, 0x00194,   207 },
+    { 0x00195, 0x00195,    97 }, { 0x00196, 0x00196,   211 }, { 0x00197, 0x00197,   209 },
+    { 0x00198, 0x00198,     1 }, { 0x0019A, 0x0019A,   163 }, { 0x0019C, 0x0019C,   211 },
+    { 0x0019D, 0x0019D,   213 }, { 0x0019E, 0x0019E,   130 }, { 0x0019F, 0x0019F,   214 },
+    { 0x001A0, 0x001A5,     0 }, { 0x001A6, 0x001A6,   218 }, { 0x001A7, 0x001A7,     1 },
+    { 0x001A9, 0x001A9,   218 }, { 0x001AC, 0x001AC,     1 }, { 0x001AE, 0x001AE,   218 },
+    { 0x001AF, 0x001AF,     1 }, { 0x001B1, 0x001B2,   217 }, { 0x001B3, 0x001B6,     0 },
+    { 0x001B7, 0x001B7,   219 }, { 0x001B8, 0x001B8,     1 }, { 0x001BC, 0x001BC,     1 },
+    { 0x001BF, 0x001BF,    56 }, { 0x001C4, 0x001C4,     2 }, { 0x001C5, 0x001C5,     1 },
+    { 0x001C7, 0x001C7,     2 }, { 0x001C8, 0x001C8,     1 }, { 0x001CA, 0x001CA,     2 },
+    { 0x001CB, 0x001DC,     0 }, { 0x001DE, 0x001EF,     0 }, { 0x001F1, 0x001F1,     2 },
+    { 0x001F2, 0x001F5,     0 }, { 0x001F8, 0x0021F,     0 }, { 0x00222, 0x00233,     0 },
+    { 0x0023A, 0x0023A, 10795 }, { 0x0023B, 0x0023B,     1 }, { 0x0023E, 0x0023E, 10792 },
+    { 0x0023F, 0x00240, 10815 }, { 0x00241, 0x00241,     1 }, { 0x00244, 0x00244,    69 },
+    { 0x00245, 0x00245,    71 }, { 0x00246, 0x0024F,     0 }, { 0x00250, 0x00250, 10783 },
+    { 0x00251, 0x00251, 10780 }, { 0x00252, 0x00252, 10782 }, { 0x0025C, 0x0025C, 42319 },
+    { 0x00261, 0x00261, 42315 }, { 0x00265, 0x00265, 42280 }, { 0x00266, 0x00266, 42308 },
+    { 0x0026A, 0x0026A, 42308 }, { 0x0026B, 0x0026B, 10743 }, { 0x0026C, 0x0026C, 42305 },
+    { 0x00271, 0x00271, 10749 }, { 0x0027D, 0x0027D, 10727 }, { 0x00282, 0x00282, 42307 },
+    { 0x00287, 0x00287, 42282 }, { 0x0029D, 0x0029D, 42261 }, { 0x0029E, 0x0029E, 42258 },
+    { 0x00345, 0x00345,   116 }, { 0x00370, 0x00373,     0 }, { 0x00376, 0x00376,     1 },
+    { 0x0037B, 0x0037D,   130 }, { 0x0037F, 0x0037F,   116 }, { 0x00386, 0x00386,    38 },
+    { 0x00388, 0x0038A,    37 }, { 0x0038C, 0x0038C,    64 }, { 0x0038E, 0x0038F,    63 },
+    { 0x00391, 0x003A1,    32 }, { 0x003A3, 0x003AB,    32 }, { 0x003B2, 0x003B2,    30 },
+    { 0x003B5, 0x003B5,    64 }, { 0x003B8, 0x003B8,    25 }, { 0x003B8, 0x003B8,    60 },
+    { 0x003B9, 0x003B9,  7173 }, { 0x003BA, 0x003BA,    54 }, { 0x003C0, 0x003C0,    22 },
+    { 0x003C1, 0x003C1,    48 }, { 0x003C2, 0x003C2,     1 }, { 0x003C6, 0x003C6,    15 },
+    { 0x003C9, 0x003C9,  7517 }, { 0x003CF, 0x003CF,     8 }, { 0x003D8, 0x003EF,     0 },
+    { 0x003F2, 0x003F2,     7 }, { 0x003F7, 0x003F7,     1 }, { 0x003FA, 0x003FA,     1 },
+    { 0x00400, 0x0040F,    80 }, { 0x00410, 0x0042F,    32 }, { 0x00432, 0x00432,  6222 },
+    { 0x00434, 0x00434,  6221 }, { 0x0043E, 0x0043E,  6212 }, { 0x00441, 0x00442,  6210 },
+    { 0x00442, 0x00442,  6211 }, { 0x0044A, 0x0044A,  6204 }, { 0x00460, 0x00463,     0 },
+    { 0x00463, 0x00463,  6180 }, { 0x00464, 0x00481,     0 }, { 0x0048A, 0x004BF,     0 },
+    { 0x004C0, 0x004C0,    15 }, { 0x004C1, 0x004CE,     0 }, { 0x004D0, 0x0052F,     0 },
+    { 0x00531, 0x00556,    48 }, { 0x010A0, 0x010C5,  7264 }, { 0x010C7, 0x010C7,  7264 },
+    { 0x010CD, 0x010CD,  7264 }, { 0x010D0, 0x010FA,  3008 }, { 0x010FD, 0x010FF,  3008 },
+    { 0x013A0, 0x013EF, 38864 }, { 0x013F0, 0x013F5,     8 }, { 0x01C88, 0x01C88, 35267 },
+    { 0x01D79, 0x01D79, 35332 }, { 0x01D7D, 0x01D7D,  3814 }, { 0x01D8E, 0x01D8E, 35384 },
+    { 0x01E00, 0x01E61,     0 }, { 0x01E61, 0x01E61,    58 }, { 0x01E62, 0x01E95,     0 },
+    { 0x01EA0, 0x01EFF,     0 }, { 0x01F00, 0x01F07,     8 }, { 0x01F10, 0x01F15,     8 },
+    { 0x01F20, 0x01F27,     8 }, { 0x01F30, 0x01F37,     8 }, { 0x01F40, 0x01F45,     8 },
+    { 0x01F51, 0x01F51,     8 }, { 0x01F53, 0x01F53,     8 }, { 0x01F55, 0x01F55,     8 },
+    { 0x01F57, 0x01F57,     8 }, { 0x01F60, 0x01F67,     8 }, { 0x01F70, 0x01F71,    74 },
+    { 0x01F72, 0x01F75,    86 }, { 0x01F76, 0x01F77,   100 }, { 0x01F78, 0x01F79,   128 },
+    { 0x01F7A, 0x01F7B,   112 }, { 0x01F7C, 0x01F7D,   126 }, { 0x01F80, 0x01F87,     8 },
+    { 0x01F90, 0x01F97,     8 }, { 0x01FA0, 0x01FA7,     8 }, { 0x01FB0, 0x01FB1,     8 },
+    { 0x01FB3, 0x01FB3,     9 }, { 0x01FC3, 0x01FC3,     9 }, { 0x01FD0, 0x01FD1,     8 },
+    { 0x01FE0, 0x01FE1,     8 }, { 0x01FE5, 0x01FE5,     7 }, { 0x01FF3, 0x01FF3,     9 },
+    { 0x02132, 0x02132,    28 }, { 0x02160, 0x0216F,    16 }, { 0x02183, 0x02183,     1 },
+    { 0x024B6, 0x024CF,    26 }, { 0x02C00, 0x02C2F,    48 }, { 0x02C60, 0x02C60,     1 },
+    { 0x02C67, 0x02C6C,     0 }, { 0x02C72, 0x02C72,     1 }, { 0x02C75, 0x02C75,     1 },
+    { 0x02C80, 0x02CE3,     0 }, { 0x02CEB, 0x02CEE,     0 }, { 0x02CF2, 0x02CF2,     1 },
+    { 0x0A640, 0x0A66D,     0 }, { 0x0A680, 0x0A69B,     0 }, { 0x0A722, 0x0A72F,     0 },
+    { 0x0A732, 0x0A76F,     0 }, { 0x0A779, 0x0A77C,     0 }, { 0x0A77E, 0x0A787,     0 },
+    { 0x0A78B, 0x0A78B,     1 }, { 0x0A790, 0x0A793,     0 }, { 0x0A794, 0x0A794,    48 },
+    { 0x0A796, 0x0A7A9,     0 }, { 0x0A7B3, 0x0A7B3,   928 }, { 0x0A7B4, 0x0A7C3,     0 },
+    { 0x0A7C7, 0x0A7CA,     0 }, { 0x0A7D0, 0x0A7D0,     1 }, { 0x0A7D6, 0x0A7D9,     0 },
+    { 0x0A7F5, 0x0A7F5,     1 }, { 0x0FF21, 0x0FF3A,    32 }, { 0x10400, 0x10427,    40 },
+    { 0x104B0, 0x104D3,    40 }, { 0x10570, 0x1057A,    39 }, { 0x1057C, 0x1058A,    39 },
+    { 0x1058C, 0x10592,    39 }, { 0x10594, 0x10595,    39 }, { 0x10C80, 0x10CB2,    64 },
+    { 0x118A0, 0x118BF,    32 }, { 0x16E40, 0x16E5F,    32 }, { 0x1E900, 0x1E921,    34 },
+  };
+
+const unsigned int qre::num_case_pairs = 207;
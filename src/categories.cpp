@@ -0,0 +1,1287 @@
+/*
+ * Copyright 2016 Nils Christopher Brause
+ *
+ * This file is part of libqre.
+ *
+ * libqre is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libqre is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libqre.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// generated by tools/gen_categories.py from Unicode 14.0.0
+
+#include <qre.hpp>
+
+namespace
+{
+  const uint8_t groups[1088] =
+    {
+        0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,
+       13,  13,  13,  13,  13,  14,  13,  13,  13,  13,  13,  13,  13,  13,
+       13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  15,  16,
+       17,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  18,  19,  19,
+       20,  20,  20,  20,  20,  20,  21,  22,  23,  24,  25,  26,  27,  28,
+       29,  30,  31,  32,  33,  34,  13,  35,  33,  33,  33,  36,  33,  33,
+       33,  33,  33,  33,  33,  33,  37,  38,  13,  13,  13,  13,  13,  39,
+       13,  40,  33,  33,  33,  33,  33,  33,  33,  41,  42,  33,  33,  43,
+       33,  33,  33,  44,  45,  46,  47,  48,  49,  50,  51,  52,  53,  54,
+       55,  33,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+       13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+       13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,
+       13,  56,  13,  13,  13,  57,  58,  13,  13,  13,  13,  59,  13,  13,
+       13,  13,  13,  13,  60,  33,  33,  33,  61,  33,  13,  13,  13,  13,
+       62,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       63,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,  33,
+       33,  33,  33,  33,  33,  33,  33,  33,  20,  20,  20,  20,  20,  20,
+       20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,
+       20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,
+       20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,
+       20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,
+       20,  64,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,
+       20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,
+       20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,
+       20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,
+       20,  20,  20,  20,  20,  20,  20,  20,  20,  64,
+    };
+
+  const uint16_t blocks[2080] =
+    {
+        0,   1,   2,   3,   0,   4,   5,   6,   7,   8,   9,  10,  11,  12,
+       13,  14,   7,  15,  16,  17,  18,  19,  20,  21,  22,  22,  22,  23,
+       24,  25,  26,  27,  28,  29,  17,   7,  30,   7,  31,   7,   7,  32,
+       33,  17,  34,  35,  36,  37,  38,  39,  40,  41,  39,  39,  42,  43,
+       44,  45,  46,  39,  39,  47,  48,  49,  50,  51,  52,  53,  54,  39,
+       55,  56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,
+       69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,  80,  81,  82,
+       83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94,  95,  96,
+       97,  98,  99, 100, 101, 102, 103, 100, 104, 105, 106, 107, 108, 109,
+      110, 100,  39, 111, 112, 113, 114,  28, 115, 116,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39, 117,  39, 118, 119, 120,  39, 121,  39,
+      122, 123, 124,  28,  28, 125, 126,  39,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39, 127, 128,  39,
+       39, 129, 130, 131, 132, 133,  39, 134, 135, 136, 137,  39, 138, 139,
+      140, 141,  39, 142, 143, 144, 145, 146,  39, 147, 148, 149, 150,  39,
+      151, 152, 153, 154, 155, 100, 156, 157, 158, 159, 160, 161,  39, 162,
+       39, 163, 164, 165, 166, 167, 168, 169,  17, 170, 171, 172, 173, 171,
+       22,  22,   7,   7,   7,   7, 174,   7,   7,   7, 175, 176, 177, 178,
+      179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192,
+      193, 194, 195, 196, 197, 198, 199, 199, 199, 199, 199, 199, 199, 199,
+      200, 201, 149, 202, 203, 204, 205, 206, 149, 207, 208, 209, 210, 149,
+      149, 211, 149, 149, 149, 149, 149, 212, 213, 214, 149, 149, 149, 215,
+      149, 149, 149, 149, 149, 149, 149, 216, 217, 149, 218, 219, 149, 149,
+      149, 149, 149, 149, 149, 149, 199, 199, 199, 199, 220, 199, 221, 222,
+      199, 199, 199, 199, 199, 199, 199, 199, 149, 223, 224, 225, 226, 149,
+      149, 149,  28,  29,  17, 227,   7,   7,   7, 228,  17, 229,  39, 230,
+      231, 232, 232,  22, 233, 234, 235, 100, 236, 149, 149, 237, 149, 149,
+      149, 149, 149, 149, 238, 239, 240, 241,  97,  39, 242, 126,  39, 243,
+      244, 245,  39,  39, 246,  39, 149, 247, 248, 249, 250, 149, 249, 251,
+      149, 149, 149, 149, 149, 149, 149, 149, 149, 149,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,
+      149, 149,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39, 252,  39,  39,  39,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39, 253, 149,
+      254, 165,  39,  39,  39,  39,  39,  39,  39,  39, 255, 256,   7, 257,
+      258,  39,  39, 259, 260, 261,   7, 262, 263, 264, 265, 266, 267, 268,
+       39, 269, 270, 271, 272, 273,  48, 274, 275, 276,  57, 277, 278, 279,
+       39, 280, 281, 282,  39, 283, 284, 285, 286, 287, 288, 289,  17,  17,
+       39, 290,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,
+       39,  39,  39, 291, 292, 293, 294, 294, 294, 294, 294, 294, 294, 294,
+      294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294,
+      294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 295, 295, 295, 295,
+      295, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295,
+      295, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295,
+      295, 295, 295, 295, 295, 295, 295, 295,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39, 296,  39,  39, 297, 100, 298, 299, 300,  39,
+       39, 301, 302,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39, 303,
+      304,  39, 305,  39, 306, 307, 308, 309, 310, 311,  39,  39,  39, 312,
+      313,   2, 314, 315, 316, 143, 317, 318, 319, 320, 321, 100,  39,  39,
+       39, 322, 323, 324, 194, 325, 326, 327, 328, 329, 100, 100, 100, 100,
+      276,  39, 330, 331,  39, 332, 333, 334, 335,  39, 336, 100,  28, 337,
+      338,  39, 339, 340, 341, 342,  39, 343,  39, 344, 345, 346, 100, 100,
+       39,  39,  39,  39,  39,  39,  39,  39,  39, 231, 142, 347, 348, 349,
+      100, 100, 350, 351, 352, 353, 143, 354, 100, 355, 356, 357, 100, 100,
+       39, 358, 359, 209, 360, 361, 362, 363, 364, 100, 365, 366,  39, 367,
+      368, 369, 370, 371, 100, 100,  39,  39, 372, 100,  28, 373,  17, 374,
+       39, 375, 100, 100, 100, 100, 100, 100, 100, 100, 100, 376,  39, 377,
+      100, 100, 364, 378, 379, 380, 381, 380, 382, 231, 383, 384, 385, 386,
+      160, 387, 388, 389, 390, 391, 392, 393, 160, 394, 395, 396, 397, 398,
+      100, 100, 399, 400, 401, 402, 403, 404, 405, 406, 100, 100, 100, 100,
+       39, 407, 408, 409,  39, 410, 411, 100, 100, 100, 100, 100,  39, 412,
+      413, 100,  39, 414, 415, 416,  39, 417, 418, 100, 122, 419, 420, 100,
+      100, 100, 100, 100,  39, 421, 100, 100, 100,  28,  17, 422, 423, 424,
+      425, 100, 100, 426, 427, 428, 429, 430, 431,  39, 432, 433,  39, 139,
+      100, 100, 100, 100, 100, 100, 100, 100, 434, 435, 436, 437, 438, 439,
+      100, 100, 440, 441, 442, 443, 444, 418, 100, 100, 100, 100, 100, 100,
+      100, 100, 100, 445, 100, 100, 100, 100, 100, 446, 447, 448,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39, 297, 100,
+      100, 100, 194, 194, 194, 449,  39,  39,  39,  39,  39,  39, 450, 100,
+      100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+      100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+      100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+      100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+      100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+      100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 380,  39,  39, 451,
+       39, 452, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+      100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+      100, 100, 100, 100,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39, 420, 100, 100, 100, 100, 100,
+      100, 100, 100, 100, 100, 100, 100, 100,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39, 139, 143, 453,
+       39, 143, 454, 455,  39, 456, 457, 458, 459, 100, 100, 100, 100, 100,
+      100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+      100, 100,  28,  17, 460, 100, 100, 100,  39,  39, 461, 462, 463, 100,
+      100, 464,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39, 465,  39,  39,  39,  39,  39,  39, 142, 100,
+      372, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+      100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+      100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+      100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 466,
+       39,  39,  39,  39,  39,  39,  39,  39,  39, 467, 468, 469,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39,  39, 293, 100, 100, 100, 100,
+      100, 100, 100, 100,  39,  39,  39, 470, 471, 472, 100, 100, 100, 100,
+      100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+      100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+      100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+      100, 100, 100, 100,  22, 473, 474, 149, 149, 149, 475, 100, 149, 149,
+      149, 149, 149, 149, 149, 238, 149, 476, 149, 477, 478, 479, 149, 208,
+      149, 149, 480, 100, 100, 100, 100, 481, 149, 149, 482, 483, 100, 100,
+      100, 100, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495,
+      496, 484, 485, 497, 487, 498, 499, 500, 491, 501, 502, 503, 504, 505,
+      506, 507, 508, 509, 510, 511, 149, 149, 149, 149, 149, 149, 149, 149,
+      149, 149, 149, 149, 149, 149, 149, 149,  22, 512,  22, 513, 514, 515,
+      100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+      100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+      100, 100, 100, 100, 100, 100, 516, 100, 100, 100, 100, 100, 100, 100,
+      517, 518, 100, 100, 100, 100, 100, 100,  39, 519, 520, 100, 100, 100,
+      100, 100, 100, 100, 100, 100, 380, 521,  39, 522, 100, 100, 100, 100,
+      100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+      100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+      100, 100, 100, 100, 100, 100, 100, 523,  39,  39,  39,  39,  39,  39,
+      524, 100,  28, 525, 526, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+      100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+      100, 527, 209, 528, 100, 100, 529, 530, 100, 100, 100, 100, 100, 100,
+      531, 532, 533, 534, 535, 536, 100, 537, 100, 100, 100, 100, 100, 100,
+      100, 100, 149, 538, 149, 149, 237, 539, 540, 238, 541, 149, 149, 149,
+      149, 542, 100, 543, 544, 545, 546, 547, 100, 100, 100, 100, 149, 149,
+      149, 149, 149, 149, 149, 548, 149, 149, 149, 149, 149, 149, 149, 149,
+      149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149,
+      549, 550, 149, 149, 149, 237, 149, 149, 551, 552, 538, 149, 553, 149,
+      554, 555, 100, 100, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149,
+      237, 556, 557, 558, 559, 560, 149, 149, 149, 149, 561, 149, 208, 562,
+       39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39,  39, 100,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,
+       39, 139,  39,  39,  39,  39,  39,  39, 339,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39, 563,  39,  39,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39, 564,  39,  39,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39, 339, 100, 100, 100, 100, 100,
+      100, 100, 100, 100, 100, 100, 100, 100, 100, 100,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,  39,
+       39,  39,  39,  39,  39,  39,  39,  39, 565, 100, 100, 100, 100, 100,
+      566, 567, 567, 567, 100, 100, 100, 100,  22,  22,  22,  22,  22,  22,
+       22, 568, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+      100, 100, 100, 100, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295,
+      295, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295,
+      295, 295, 295, 295, 295, 295, 295, 569,
+    };
+
+  const uint8_t categories[18240] =
+    {
+       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+       0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 29, 21, 21, 21,
+      23, 21, 21, 21, 22, 18, 21, 25, 21, 17, 21, 21, 13, 13, 13, 13, 13, 13,
+      13, 13, 13, 13, 21, 21, 25, 25, 25, 21, 21,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+       9, 22, 21, 18, 24, 16, 24,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5, 22, 25, 18,
+      25,  0, 29, 21, 23, 23, 23, 23, 26, 21, 24, 26,  7, 20, 25,  1, 26, 24,
+      26, 25, 15, 15, 24,  5, 21, 21, 24, 15,  7, 19, 15, 15, 15, 21,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9, 25,  9,  9,  9,  9,  9,  9,  9,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5, 25,
+       5,  5,  5,  5,  5,  5,  5,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,
+       9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,
+       9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,
+       9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  5,  9,  5,  9,  5,  9,  5,  9,
+       5,  9,  5,  9,  5,  9,  5,  9,  5,  5,  9,  5,  9,  5,  9,  5,  9,  5,
+       9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,
+       9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,
+       9,  5,  9,  9,  5,  9,  5,  9,  5,  5,  5,  9,  9,  5,  9,  5,  9,  9,
+       5,  9,  9,  9,  5,  5,  9,  9,  9,  9,  5,  9,  9,  5,  9,  9,  9,  5,
+       5,  5,  9,  9,  5,  9,  9,  5,  9,  5,  9,  5,  9,  9,  5,  9,  5,  5,
+       9,  5,  9,  9,  5,  9,  9,  9,  5,  9,  5,  9,  9,  5,  5,  7,  9,  5,
+       5,  5,  7,  7,  7,  7,  9,  8,  5,  9,  8,  5,  9,  8,  5,  9,  5,  9,
+       5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  5,  9,  5,  9,  5,
+       9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  5,  9,  8,  5,
+       9,  5,  9,  9,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,
+       9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  5,  5,  5,  5,
+       5,  5,  9,  9,  5,  9,  9,  5,  5,  9,  5,  9,  9,  9,  9,  5,  9,  5,
+       9,  5,  9,  5,  9,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  7,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  6,  6,  6,  6,  6,  6,
+       6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6, 24, 24, 24, 24,  6,  6,
+       6,  6,  6,  6,  6,  6,  6,  6,  6,  6, 24, 24, 24, 24, 24, 24, 24, 24,
+      24, 24, 24, 24, 24, 24,  6,  6,  6,  6,  6, 24, 24, 24, 24, 24, 24, 24,
+       6, 24,  6, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+      24, 24, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  9,  5,  9,  5,
+       6, 24,  9,  5,  2,  2,  6,  5,  5,  5, 21,  9,  2,  2,  2,  2, 24, 24,
+       9, 21,  9,  9,  9,  2,  9,  2,  9,  9,  5,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  2,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  9,  5,  5,  9,  9,  9,  5,  5,  5,  9,  5,  9,  5,  9,  5,  9,  5,
+       9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  5,  5,
+       5,  5,  9,  5, 25,  9,  5,  9,  9,  5,  5,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  9,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  9,  5, 26, 12, 12, 12, 12, 12, 11, 11,  9,  5,
+       9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,
+       9,  5,  9,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  5,
+       9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,
+       9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  2,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  2,
+       2,  6, 21, 21, 21, 21, 21, 21,  5,  5,  5,  5,  5,  5,  5,  5,  5, 21,
+      17,  2,  2, 26, 26, 23,  2, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 17, 12,
+      21, 12, 12, 21, 12, 12, 21, 12,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  2,  2,  2,  2,  7,  7,  7,  7, 21, 21,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  1,  1,  1,  1,  1,  1, 25, 25,
+      25, 21, 21, 23, 21, 21, 26, 26, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+      12, 21,  1, 21, 21, 21,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  6,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13,
+      13, 13, 13, 13, 13, 13, 13, 13, 21, 21, 21, 21,  7,  7, 12,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 21,  7, 12, 12,
+      12, 12, 12, 12, 12,  1, 26, 12, 12, 12, 12, 12, 12,  6,  6, 12, 12, 26,
+      12, 12, 12, 12,  7,  7, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  7,  7,
+       7, 26, 26,  7, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+       2,  1,  7, 12,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12, 12,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12, 12,  7,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 12, 12, 12, 12, 12,
+      12, 12, 12, 12,  6,  6, 26, 21, 21, 21,  6,  2,  2, 12, 23, 23,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7, 12, 12, 12, 12,  6, 12, 12, 12, 12, 12, 12, 12, 12, 12,  6, 12,
+      12, 12,  6, 12, 12, 12, 12, 12,  2,  2, 21, 21, 21, 21, 21, 21, 21, 21,
+      21, 21, 21, 21, 21, 21, 21,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 12, 12, 12,
+       2,  2, 21,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2,
+       2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7, 24,  7,  7,  7,  7,  7,  7,  2,  1,  1,
+       2,  2,  2,  2,  2,  2, 12, 12, 12, 12, 12, 12, 12, 12,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  6, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  1, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12, 12, 10,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 12, 10, 12,  7, 10, 10, 10, 12,
+      12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 12, 10, 10,  7, 12, 12, 12,
+      12, 12, 12, 12,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 12, 12, 21, 21,
+      13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 21,  6,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7, 12, 10, 10,  2,  7,  7,  7,  7,  7,
+       7,  7,  7,  2,  2,  7,  7,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  7,  7,  7,  7,
+       7,  7,  7,  2,  7,  2,  2,  2,  7,  7,  7,  7,  2,  2, 12,  7, 10, 10,
+      10, 12, 12, 12, 12,  2,  2, 10, 10,  2,  2, 10, 10, 12,  7,  2,  2,  2,
+       2,  2,  2,  2,  2, 10,  2,  2,  2,  2,  7,  7,  2,  7,  7,  7, 12, 12,
+       2,  2, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  7,  7, 23, 23, 15, 15,
+      15, 15, 15, 15, 26, 23,  7, 21, 12,  2,  2, 12, 12, 10,  2,  7,  7,  7,
+       7,  7,  7,  2,  2,  2,  2,  7,  7,  2,  2,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  7,  7,
+       7,  7,  7,  7,  7,  2,  7,  7,  2,  7,  7,  2,  7,  7,  2,  2, 12,  2,
+      10, 10, 10, 12, 12,  2,  2,  2,  2, 12, 12,  2,  2, 12, 12, 12,  2,  2,
+       2, 12,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  2,  7,  2,  2,  2,
+       2,  2,  2,  2, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 12,  7,  7,
+       7, 12, 21,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 12, 12, 10,  2,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  2,  7,  7,  7,  2,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,
+       7,  7,  7,  7,  7,  7,  7,  2,  7,  7,  2,  7,  7,  7,  7,  7,  2,  2,
+      12,  7, 10, 10, 10, 12, 12, 12, 12, 12,  2, 12, 12, 10,  2, 10, 10, 12,
+       2,  2,  7,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       7,  7, 12, 12,  2,  2, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 21, 23,
+       2,  2,  2,  2,  2,  2,  2,  7, 12, 12, 12, 12, 12, 12,  2, 12, 10, 10,
+       2,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  7,  7,  2,  2,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  2,  7,  7,  7,  7,  7,  7,  7,  2,  7,  7,  2,  7,  7,  7,  7,  7,
+       2,  2, 12,  7, 10, 12, 10, 12, 12, 12, 12,  2,  2, 10, 10,  2,  2, 10,
+      10, 12,  2,  2,  2,  2,  2,  2,  2, 12, 12, 10,  2,  2,  2,  2,  7,  7,
+       2,  7,  7,  7, 12, 12,  2,  2, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+      26,  7, 15, 15, 15, 15, 15, 15,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      12,  7,  2,  7,  7,  7,  7,  7,  7,  2,  2,  2,  7,  7,  7,  2,  7,  7,
+       7,  7,  2,  2,  2,  7,  7,  2,  7,  2,  7,  7,  2,  2,  2,  7,  7,  2,
+       2,  2,  7,  7,  7,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  2,  2,  2,  2, 10, 10, 12, 10, 10,  2,  2,  2, 10, 10, 10,  2,
+      10, 10, 10, 12,  2,  2,  7,  2,  2,  2,  2,  2,  2, 10,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 13, 13, 13, 13, 13, 13, 13, 13,
+      13, 13, 15, 15, 15, 26, 26, 26, 26, 26, 26, 23, 26,  2,  2,  2,  2,  2,
+      12, 10, 10, 10, 12,  7,  7,  7,  7,  7,  7,  7,  7,  2,  7,  7,  7,  2,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  2,  2, 12,  7, 12, 12, 12, 10, 10, 10, 10,  2, 12, 12,
+      12,  2, 12, 12, 12, 12,  2,  2,  2,  2,  2,  2,  2, 12, 12,  2,  7,  7,
+       7,  2,  2,  7,  2,  2,  7,  7, 12, 12,  2,  2, 13, 13, 13, 13, 13, 13,
+      13, 13, 13, 13,  2,  2,  2,  2,  2,  2,  2, 21, 15, 15, 15, 15, 15, 15,
+      15, 26,  7, 12, 10, 10, 21,  7,  7,  7,  7,  7,  7,  7,  7,  2,  7,  7,
+       7,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       2,  7,  7,  7,  7,  7,  2,  2, 12,  7, 10, 12, 10, 10, 10, 10, 10,  2,
+      12, 10, 10,  2, 10, 10, 12, 12,  2,  2,  2,  2,  2,  2,  2, 10, 10,  2,
+       2,  2,  2,  2,  2,  7,  7,  2,  7,  7, 12, 12,  2,  2, 13, 13, 13, 13,
+      13, 13, 13, 13, 13, 13,  2,  7,  7,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2, 12, 12, 10, 10,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,
+       7,  7,  7,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7, 12, 12,  7, 10, 10, 10, 12, 12, 12,
+      12,  2, 10, 10, 10,  2, 10, 10, 10, 12,  7, 26,  2,  2,  2,  2,  7,  7,
+       7, 10, 15, 15, 15, 15, 15, 15, 15,  7,  7,  7, 12, 12,  2,  2, 13, 13,
+      13, 13, 13, 13, 13, 13, 13, 13, 15, 15, 15, 15, 15, 15, 15, 15, 15, 26,
+       7,  7,  7,  7,  7,  7,  2, 12, 10, 10,  2,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  7,  2,  2,  7,  7,
+       7,  7,  7,  7,  7,  2,  2,  2, 12,  2,  2,  2,  2, 10, 10, 10, 12, 12,
+      12,  2, 12,  2, 10, 10, 10, 10, 10, 10, 10, 10,  2,  2,  2,  2,  2,  2,
+      13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  2,  2, 10, 10, 21,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7, 12,  7,  7, 12, 12, 12, 12, 12, 12, 12,  2,  2,  2,  2, 23,
+       7,  7,  7,  7,  7,  7,  6, 12, 12, 12, 12, 12, 12, 12, 12, 21, 13, 13,
+      13, 13, 13, 13, 13, 13, 13, 13, 21, 21,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  2,  7,  2,  7,  7,
+       7,  7,  7,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  7,  2,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7, 12,  7,  7, 12, 12, 12, 12, 12, 12, 12, 12, 12,  7,
+       2,  2,  7,  7,  7,  7,  7,  2,  6,  2, 12, 12, 12, 12, 12, 12,  2,  2,
+      13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  2,  2,  7,  7,  7,  7,  7, 26,
+      26, 26, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 26,
+      21, 26, 26, 26, 12, 12, 26, 26, 26, 26, 26, 26, 13, 13, 13, 13, 13, 13,
+      13, 13, 13, 13, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 26, 12, 26, 12,
+      26, 12, 22, 18, 22, 18, 10, 10,  7,  7,  7,  7,  7,  7,  7,  7,  2,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,
+       2,  2,  2, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
+      12, 12, 12, 12, 12, 21, 12, 12,  7,  7,  7,  7,  7, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12,  2, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12, 12,  2, 26, 26, 26, 26, 26, 26, 26, 26, 12, 26,
+      26, 26, 26, 26, 26,  2, 26, 26, 21, 21, 21, 21, 21, 26, 26, 26, 26, 21,
+      21,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 10,
+      10, 12, 12, 12, 12, 10, 12, 12, 12, 12, 12, 12, 10, 12, 12, 10, 10, 12,
+      12,  7, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 21, 21, 21, 21, 21, 21,
+       7,  7,  7,  7,  7,  7, 10, 10, 12, 12,  7,  7,  7,  7, 12, 12, 12,  7,
+      10, 10, 10,  7,  7, 10, 10, 10, 10, 10, 10, 10,  7,  7,  7, 12, 12, 12,
+      12,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 12, 10, 10, 12,
+      12, 10, 10, 10, 10, 10, 10, 12,  7, 10, 13, 13, 13, 13, 13, 13, 13, 13,
+      13, 13, 10, 10, 10, 12, 26, 26,  9,  9,  9,  9,  9,  9,  2,  9,  2,  2,
+       2,  2,  2,  9,  2,  2,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5, 21,  6,  5,  5,  5,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  7,  7,  7,  7,  2,  2,  7,  7,
+       7,  7,  7,  7,  7,  2,  7,  2,  7,  7,  7,  7,  2,  2,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  2,  7,  7,  7,  7,  2,  2,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  7,  7,  7,  7,  2,  2,  7,  7,
+       7,  7,  7,  7,  7,  2,  7,  2,  7,  7,  7,  7,  2,  2,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  2,  7,  7,  7,  7,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  2,  2, 12, 12, 12, 21, 21, 21, 21, 21, 21,
+      21, 21, 21, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,  2,  2,
+       2,  2,  2,  2,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  9,  2,  2,  5,  5,  5,  5,  5,  5,  2,  2,
+      17,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7, 26, 21,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 29,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7, 22, 18,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 21,
+      21, 21, 14, 14, 14,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2,  2,  2,
+       2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7, 12, 12, 12, 10,  2,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 12, 12,
+      10, 21, 21,  2,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 12, 12,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  2,  7,  7,  7,  2, 12, 12,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7, 12, 12, 10, 12, 12, 12, 12, 12, 12, 12, 10, 10,
+      10, 10, 10, 10, 10, 10, 12, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+      12, 12, 21, 21, 21,  6, 21, 21, 21, 23,  7, 12,  2,  2, 13, 13, 13, 13,
+      13, 13, 13, 13, 13, 13,  2,  2,  2,  2,  2,  2, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15,  2,  2,  2,  2,  2,  2, 21, 21, 21, 21, 21, 21, 17, 21,
+      21, 21, 21, 12, 12, 12,  1, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+       2,  2,  2,  2,  2,  2,  7,  7,  7,  6,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2,  2,  2,  2,  2,  7,  7,
+       7,  7,  7, 12, 12,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7, 12,  7,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,
+      12, 12, 12, 10, 10, 10, 10, 12, 12, 10, 10, 10,  2,  2,  2,  2, 10, 10,
+      12, 10, 10, 10, 10, 10, 10, 12, 12, 12,  2,  2,  2,  2, 26,  2,  2,  2,
+      21, 21, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  2,  2,  7,  7,  7,  7,  7,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2,  2,  2,  2,
+      13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 15,  2,  2,  2, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 12,
+      12, 10, 10, 12,  2,  2, 21, 21,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 10, 12, 10, 12, 12, 12, 12,
+      12, 12, 12,  2, 12, 10, 12, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 10,
+      10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  2,  2, 12,
+      13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  2,  2,  2,  2,  2,  2, 13, 13,
+      13, 13, 13, 13, 13, 13, 13, 13,  2,  2,  2,  2,  2,  2, 21, 21, 21, 21,
+      21, 21, 21,  6, 21, 21, 21, 21, 21, 21,  2,  2, 12, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12, 12,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2, 12, 12, 12, 12, 10,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7, 12, 10, 12, 12, 12, 12, 12, 10, 12, 10, 10, 10, 10, 10,
+      12, 10, 10,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2, 13, 13, 13, 13,
+      13, 13, 13, 13, 13, 13, 21, 21, 21, 21, 21, 21, 21, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 12, 12, 12, 12, 12, 12, 12, 12, 12, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 21, 21,  2, 12, 12, 10,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7, 10, 12, 12, 12, 12, 10, 10, 12, 12, 10, 12, 12, 12,
+       7,  7, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7, 12, 10, 12, 12, 10, 10, 10, 12, 10, 12, 12, 12,
+      10, 10,  2,  2,  2,  2,  2,  2,  2,  2, 21, 21, 21, 21,  7,  7,  7,  7,
+      10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
+      12, 12,  2,  2,  2, 21, 21, 21, 21, 21, 13, 13, 13, 13, 13, 13, 13, 13,
+      13, 13,  2,  2,  2,  7,  7,  7, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  6,  6,  6,  6,  6,  6,
+      21, 21,  5,  5,  5,  5,  5,  5,  5,  5,  5,  2,  2,  2,  2,  2,  2,  2,
+       9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  2,  2,  9,  9,  9, 21, 21, 21, 21, 21, 21,
+      21, 21,  2,  2,  2,  2,  2,  2,  2,  2, 12, 12, 12, 21, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 12, 12, 12, 12, 12, 12, 12,  7,
+       7,  7,  7, 12,  7,  7,  7,  7,  7,  7, 12,  7,  7, 10, 12, 12,  7,  2,
+       2,  2,  2,  2,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  6,  6,
+       6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+       6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+       6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+       6,  6,  6,  6,  6,  6,  6,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  6,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  6,  6,  6,  6,  6,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,
+       9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       9,  5,  5,  5,  5,  5,  5,  5,  5,  5,  9,  9,  9,  9,  9,  9,  9,  9,
+       5,  5,  5,  5,  5,  5,  2,  2,  9,  9,  9,  9,  9,  9,  2,  2,  5,  5,
+       5,  5,  5,  5,  5,  5,  9,  9,  9,  9,  9,  9,  9,  9,  5,  5,  5,  5,
+       5,  5,  5,  5,  9,  9,  9,  9,  9,  9,  9,  9,  5,  5,  5,  5,  5,  5,
+       2,  2,  9,  9,  9,  9,  9,  9,  2,  2,  5,  5,  5,  5,  5,  5,  5,  5,
+       2,  9,  2,  9,  2,  9,  2,  9,  5,  5,  5,  5,  5,  5,  5,  5,  9,  9,
+       9,  9,  9,  9,  9,  9,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  2,  2,  5,  5,  5,  5,  5,  5,  5,  5,  8,  8,  8,  8,  8,  8,
+       8,  8,  5,  5,  5,  5,  5,  5,  5,  5,  8,  8,  8,  8,  8,  8,  8,  8,
+       5,  5,  5,  5,  5,  5,  5,  5,  8,  8,  8,  8,  8,  8,  8,  8,  5,  5,
+       5,  5,  5,  2,  5,  5,  9,  9,  9,  9,  8, 24,  5, 24, 24, 24,  5,  5,
+       5,  2,  5,  5,  9,  9,  9,  9,  8, 24, 24, 24,  5,  5,  5,  5,  2,  2,
+       5,  5,  9,  9,  9,  9,  2, 24, 24, 24,  5,  5,  5,  5,  5,  5,  5,  5,
+       9,  9,  9,  9,  9, 24, 24, 24,  2,  2,  5,  5,  5,  2,  5,  5,  9,  9,
+       9,  9,  8, 24, 24,  2, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,  1,
+       1,  1,  1,  1, 17, 17, 17, 17, 17, 17, 21, 21, 20, 19, 22, 20, 20, 19,
+      22, 20, 21, 21, 21, 21, 21, 21, 21, 21, 27, 28,  1,  1,  1,  1,  1, 29,
+      21, 21, 21, 21, 21, 21, 21, 21, 21, 20, 19, 21, 21, 21, 21, 16, 16, 21,
+      21, 21, 25, 22, 18, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 25, 21,
+      16, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 29,  1,  1,  1,  1,  1,  2,
+       1,  1,  1,  1,  1,  1,  1,  1,  1,  1, 15,  6,  2,  2, 15, 15, 15, 15,
+      15, 15, 25, 25, 25, 22, 18,  6, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      25, 25, 25, 22, 18,  2,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+       6,  2,  2,  2, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+      23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+      23,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 11, 11, 11, 11, 12, 11, 11,
+      11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 26, 26,  9, 26, 26, 26, 26,  9,
+      26, 26,  5,  9,  9,  9,  5,  5,  9,  9,  9,  5, 26,  9, 26, 26, 25,  9,
+       9,  9,  9,  9, 26, 26, 26, 26, 26, 26,  9, 26,  9, 26,  9, 26,  9,  9,
+       9,  9, 26,  5,  9,  9,  9,  9,  5,  7,  7,  7,  7,  5, 26, 26,  5,  5,
+       9,  9, 25, 25, 25, 25, 25,  9,  5,  5,  5,  5, 26, 25, 26, 26,  5, 26,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 14, 14,
+      14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+      14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,  9,  5, 14,
+      14, 14, 14, 15, 26, 26,  2,  2,  2,  2, 25, 25, 25, 25, 25, 26, 26, 26,
+      26, 26, 25, 25, 26, 26, 26, 26, 25, 26, 26, 25, 26, 26, 25, 26, 26, 26,
+      26, 26, 26, 26, 25, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      25, 25, 26, 26, 25, 26, 25, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+      25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+      25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 26, 26, 26,
+      22, 18, 22, 18, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 25, 25, 26, 26, 26, 26, 26, 26, 26, 22, 18, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 25, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+      25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 25, 26, 26, 26, 26, 26, 26, 26, 26, 26, 25, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 25, 25, 25, 25,
+      25, 25, 25, 25, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 25, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 22, 18, 22, 18, 22, 18, 22, 18, 22, 18,
+      22, 18, 22, 18, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 25, 25, 25, 25, 25, 22, 18, 25,
+      25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+      25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 22, 18, 22, 18, 22, 18,
+      22, 18, 22, 18, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+      25, 25, 25, 25, 25, 22, 18, 22, 18, 22, 18, 22, 18, 22, 18, 22, 18, 22,
+      18, 22, 18, 22, 18, 22, 18, 22, 18, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+      25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+      25, 25, 25, 25, 22, 18, 22, 18, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+      25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+      25, 25, 25, 25, 22, 18, 25, 25, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+      25, 25, 25, 25, 25, 25, 25, 25, 25, 26, 26, 25, 25, 25, 25, 25, 25, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26,  2,  2, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+       2, 26, 26, 26, 26, 26, 26, 26, 26, 26,  9,  5,  9,  9,  9,  5,  5,  9,
+       5,  9,  5,  9,  5,  9,  9,  9,  9,  5,  9,  5,  5,  9,  5,  5,  5,  5,
+       5,  5,  6,  6,  9,  9,  9,  5,  9,  5,  5, 26, 26, 26, 26, 26, 26,  9,
+       5,  9,  5, 12, 12, 12,  9,  5,  2,  2,  2,  2,  2, 21, 21, 21, 21, 15,
+      21, 21,  5,  5,  5,  5,  5,  5,  2,  5,  2,  2,  2,  2,  2,  5,  2,  2,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  2,  2,  2,  2,  2,  2,  2,  6, 21,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 12,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  2,  7,  7,
+       7,  7,  7,  7,  7,  2,  7,  7,  7,  7,  7,  7,  7,  2,  7,  7,  7,  7,
+       7,  7,  7,  2, 21, 21, 20, 19, 20, 19, 21, 21, 21, 20, 19, 21, 20, 19,
+      21, 21, 21, 21, 21, 21, 21, 21, 21, 17, 21, 21, 17, 21, 20, 19, 21, 21,
+      20, 19, 22, 18, 22, 18, 22, 18, 22, 18, 21, 21, 21, 21, 21,  6, 21, 21,
+      21, 21, 21, 21, 21, 21, 21, 21, 17, 17, 21, 21, 21, 21, 17, 21, 22, 21,
+      21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 26, 26, 21, 21, 21, 22,
+      18, 22, 18, 22, 18, 22, 18, 17,  2,  2, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+       2, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26,  2,  2,  2,  2, 29, 21, 21, 21, 26,  6,
+       7, 14, 22, 18, 22, 18, 22, 18, 22, 18, 22, 18, 26, 26, 22, 18, 22, 18,
+      22, 18, 22, 18, 17, 22, 18, 18, 26, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+      12, 12, 12, 12, 10, 10, 17,  6,  6,  6,  6,  6, 26, 26, 14, 14, 14,  6,
+       7, 21, 26, 26,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2, 12, 12, 24, 24,  6,  6,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7, 21,  6,  6,  6,  7,  2,  2,  2,  2,
+       2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  2, 26, 26, 15, 15, 15, 15, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,  2, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 15, 15,
+      15, 15, 15, 15, 15, 15, 26, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  6,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       6, 21, 21, 21,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  7,  7,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  9,  5,
+       9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  7, 12, 11, 11, 11, 21,
+      12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 21,  6,  9,  5,  9,  5,  9,  5,
+       9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,
+       9,  5,  9,  5,  6,  6, 12, 12,  7,  7,  7,  7,  7,  7, 14, 14, 14, 14,
+      14, 14, 14, 14, 14, 14, 12, 12, 21, 21, 21, 21, 21, 21,  2,  2,  2,  2,
+       2,  2,  2,  2, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+      24, 24, 24, 24, 24, 24, 24, 24, 24,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+      24, 24,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  5,  5,
+       9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,
+       9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  6,  5,  5,  5,  5,  5,
+       5,  5,  5,  9,  5,  9,  5,  9,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,
+       6, 24, 24,  9,  5,  9,  5,  7,  9,  5,  9,  5,  5,  5,  9,  5,  9,  5,
+       9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,  9,  9,
+       9,  9,  9,  5,  9,  9,  9,  9,  9,  5,  9,  5,  9,  5,  9,  5,  9,  5,
+       9,  5,  9,  5,  9,  5,  9,  9,  9,  9,  5,  9,  5,  2,  2,  2,  2,  2,
+       9,  5,  2,  5,  2,  5,  9,  5,  9,  5,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  6,  6,
+       6,  9,  5,  7,  6,  6,  5,  7,  7,  7,  7,  7,  7,  7, 12,  7,  7,  7,
+      12,  7,  7,  7,  7, 12,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 10, 10, 12, 12, 10, 26, 26,
+      26, 26, 12,  2,  2,  2, 15, 15, 15, 15, 15, 15, 26, 26, 23, 26,  2,  2,
+       2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7, 21, 21, 21, 21,  2,  2,  2,  2,  2,  2,  2,  2,
+      10, 10,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 10, 10,
+      10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 12, 12,  2,  2,
+       2,  2,  2,  2,  2,  2, 21, 21, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+       2,  2,  2,  2,  2,  2, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12,  7,  7,  7,  7,  7,  7, 21, 21, 21,  7, 21,  7,
+       7, 12,  7,  7,  7,  7,  7,  7, 12, 12, 12, 12, 12, 12, 12, 12, 21, 21,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 21,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7, 12, 10, 10, 12, 12, 12, 12, 10, 10,
+      12, 12, 10, 10, 10, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+       2,  6, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  2,  2,  2,  2, 21, 21,
+       7,  7,  7,  7,  7, 12,  6,  7,  7,  7,  7,  7,  7,  7,  7,  7, 13, 13,
+      13, 13, 13, 13, 13, 13, 13, 13,  7,  7,  7,  7,  7,  2,  7,  7,  7,  7,
+       7,  7,  7,  7,  7, 12, 12, 12, 12, 12, 12, 10, 10, 12, 12, 10, 10, 12,
+      12,  2,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7, 12,  7,  7,  7,  7,
+       7,  7,  7,  7, 12, 10,  2,  2, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+       2,  2, 21, 21, 21, 21,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  6,  7,  7,  7,  7,  7,  7, 26, 26, 26,  7, 10, 12, 10,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+      12,  7, 12, 12, 12,  7,  7, 12, 12,  7,  7,  7,  7,  7, 12, 12,  7, 12,
+       7,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  7,  7,  6, 21, 21,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7, 10, 12, 12, 10, 10, 21, 21,  7,  6,  6, 10, 12,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  2,  2,  7,
+       7,  7,  7,  7,  7,  2,  2,  7,  7,  7,  7,  7,  7,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  2,  7,  7,  7,  7,  7,  7,
+       7,  2,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5, 24,  6,  6,  6,  6,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  6, 24, 24,  2,  2,  2,  2,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  7,  7,  7, 10, 10, 12, 10, 10,
+      12, 10, 10, 21, 10, 12,  2,  2, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+       2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2,  2,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2,  2,  4,  4,  4,  4,  4,  4,
+       4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+       4,  4,  4,  4,  4,  4,  4,  4,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,
+       3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,
+       3,  3,  3,  3,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2,  2,  2,  2,  5,  5,  5,  5,
+       5,  5,  5,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  5,  5,  5,
+       5,  5,  2,  2,  2,  2,  2,  7, 12,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7, 25,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  7,  7,
+       7,  7,  7,  2,  7,  2,  7,  7,  2,  7,  7,  2,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+      24,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7, 18, 22, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2,  2,  2,  2,  2, 26,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7, 23, 26, 26, 26, 12, 12, 12, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12, 21, 21, 21, 21, 21, 21, 21, 22, 18, 21,
+       2,  2,  2,  2,  2,  2, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 21, 17, 17, 16, 16, 22, 18, 22, 18, 22, 18, 22, 18, 22,
+      18, 22, 18, 22, 18, 22, 18, 21, 21, 22, 18, 21, 21, 21, 21, 16, 16, 16,
+      21, 21, 21,  2, 21, 21, 21, 21, 17, 22, 18, 22, 18, 22, 18, 21, 21, 21,
+      25, 17, 25, 25, 25,  2, 21, 23, 21, 21,  2,  2,  2,  2,  7,  7,  7,  7,
+       7,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  2,  2,  1,  2, 21, 21, 21, 23, 21, 21, 21, 22, 18,
+      21, 25, 21, 17, 21, 21, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 21, 21,
+      25, 25, 25, 21, 24,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5, 22, 25, 18, 25, 22,
+      18, 21, 22, 18, 21, 21,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  6,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  6,  6,  2,  2,  7,  7,  7,  7,  7,  7,
+       2,  2,  7,  7,  7,  7,  7,  7,  2,  2,  7,  7,  7,  7,  7,  7,  2,  2,
+       7,  7,  7,  2,  2,  2, 23, 23, 25, 24, 26, 23, 23,  2, 26, 25, 25, 25,
+      25, 26, 26,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  1,  1,  1, 26, 26,
+       2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  2,  7,  7,  2,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,
+       2,  2,  2,  2, 21, 21, 21,  2,  2,  2,  2, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15,  2,  2,  2, 26, 26, 26, 26, 26, 26, 26, 26, 26, 14, 14, 14, 14,
+      14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 15,
+      15, 15, 15, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 15, 15, 26, 26, 26,  2, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26,  2,  2,  2, 26,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 12,  2,  2,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2, 12, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+       2,  2,  2,  2, 15, 15, 15, 15,  2,  2,  2,  2,  2,  2,  2,  2,  2,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7, 14,  7,  7,  7,  7,  7,  7,  7,  7, 14,  2,  2,  2,  2,  2,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+      12, 12, 12, 12, 12,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  2, 21,  7,  7,  7,  7,  2,  2,  2,  2,  7,  7,  7,  7,
+       7,  7,  7,  7, 21, 14, 14, 14, 14, 14,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  9,  9,  9,  9,  9,  9,  9,  9,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  2,  2, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+       2,  2,  2,  2,  2,  2,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  2,  2,  2,  2,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  2,  2,  2,  2,  7,  7,  7,  7,
+       7,  7,  7,  7,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2, 21,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  2,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  2,
+       9,  9,  9,  9,  9,  9,  9,  2,  9,  9,  2,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  2,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  2,  5,  5,  5,  5,  5,  5,  5,  2,  5,  5,  2,  2,  2,  7,  7,
+       7,  7,  7,  7,  7,  7,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  6,  6,  6,  6,  6,  6,
+       2,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+       6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+       6,  6,  6,  6,  6,  6,  6,  2,  6,  6,  6,  6,  6,  6,  6,  6,  6,  2,
+       2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  2,  2,  7,  2,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  2,  7,  7,  2,  2,  2,  7,  2,  2,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       2, 21, 15, 15, 15, 15, 15, 15, 15, 15,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 26, 26, 15,
+      15, 15, 15, 15, 15, 15,  2,  2,  2,  2,  2,  2,  2, 15, 15, 15, 15, 15,
+      15, 15, 15, 15,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  2,  7,  7,  2,  2,  2,  2,  2, 15, 15, 15, 15, 15,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7, 15, 15, 15, 15, 15, 15,  2,  2,  2, 21,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  2,  2,  2,  2,  2, 21,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2,  2,
+      15, 15,  7,  7, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15,  2,  2, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+       7, 12, 12, 12,  2, 12, 12,  2,  2,  2,  2,  2, 12, 12, 12, 12,  7,  7,
+       7,  7,  2,  7,  7,  7,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       2,  2, 12, 12, 12,  2,  2,  2,  2, 12, 15, 15, 15, 15, 15, 15, 15, 15,
+      15,  2,  2,  2,  2,  2,  2,  2, 21, 21, 21, 21, 21, 21, 21, 21, 21,  2,
+       2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 15,
+      15, 21,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 15, 15, 15,  7,  7,
+       7,  7,  7,  7,  7,  7, 26,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 12,
+      12,  2,  2,  2,  2, 15, 15, 15, 15, 15, 21, 21, 21, 21, 21, 21, 21,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2, 21, 21, 21,
+      21, 21, 21, 21,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  2,  2, 15, 15, 15, 15, 15, 15, 15, 15,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  2,  2,  2,  2,  2, 15, 15, 15, 15, 15, 15, 15, 15,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2,  2,
+       2,  2,  2, 21, 21, 21, 21,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2, 15, 15, 15, 15, 15, 15, 15,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  2,
+       2,  2,  2,  2,  2,  2, 15, 15, 15, 15, 15, 15,  7,  7,  7,  7, 12, 12,
+      12, 12,  2,  2,  2,  2,  2,  2,  2,  2, 13, 13, 13, 13, 13, 13, 13, 13,
+      13, 13,  2,  2,  2,  2,  2,  2, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2, 12, 12, 17,
+       2,  2,  7,  7,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      15, 15, 15, 15, 15, 15, 15,  7,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 15, 15, 15, 15, 21,
+      21, 21, 21, 21,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7, 12, 12, 12, 12, 21, 21, 21, 21,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  7,  7,  7,  7,  7, 15, 15, 15, 15, 15, 15, 15,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 10, 12,
+      10,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+      12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 21, 21, 21,
+      21, 21, 21, 21,  2,  2,  2,  2, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 13, 13, 13, 13, 13, 13, 13, 13,
+      13, 13, 12,  7,  7, 12, 12,  7,  2,  2,  2,  2,  2,  2,  2,  2,  2, 12,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 10, 10,
+      10, 12, 12, 12, 12, 10, 10, 12, 12, 21, 21,  1, 21, 21, 21, 21, 12,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  1,  2,  2,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  2,  2,  2,  2,  2,  2,  2, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+       2,  2,  2,  2,  2,  2, 12, 12, 12,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7, 12, 12, 12, 12, 12, 10, 12, 12, 12,
+      12, 12, 12, 12, 12,  2, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 21, 21,
+      21, 21,  7, 10, 10,  7,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 12, 21, 21,  7,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7, 10, 10, 10, 12, 12, 12, 12, 12, 12,
+      12, 12, 12, 10, 10,  7,  7,  7,  7, 21, 21, 21, 21, 12, 12, 12, 12, 21,
+      10, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  7, 21,  7, 21, 21, 21,
+       2, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7, 10, 10, 10, 12, 12, 12, 10, 10, 12, 10, 12, 12, 21, 21,
+      21, 21, 21, 21, 12,  2,  7,  7,  7,  7,  7,  7,  7,  2,  7,  2,  7,  7,
+       7,  7,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 21,  2,  2,  2,  2,  2,  2,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 12, 10, 10, 10, 12, 12, 12,
+      12, 12, 12, 12, 12,  2,  2,  2,  2,  2, 13, 13, 13, 13, 13, 13, 13, 13,
+      13, 13,  2,  2,  2,  2,  2,  2, 12, 12, 10, 10,  2,  7,  7,  7,  7,  7,
+       7,  7,  7,  2,  2,  7,  7,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  7,  7,  7,  7,
+       7,  7,  7,  2,  7,  7,  2,  7,  7,  7,  7,  7,  2, 12, 12,  7, 10, 10,
+      12, 10, 10, 10, 10,  2,  2, 10, 10,  2,  2, 10, 10, 10,  2,  2,  7,  2,
+       2,  2,  2,  2,  2, 10,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7, 10, 10,
+       2,  2, 12, 12, 12, 12, 12, 12, 12,  2,  2,  2, 12, 12, 12, 12, 12,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 10, 10, 10, 12, 12,
+      12, 12, 12, 12, 12, 12, 10, 10, 12, 12, 12, 10, 12,  7,  7,  7,  7, 21,
+      21, 21, 21, 21, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 21, 21,  2, 21,
+      12,  7,  7,  7,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 10, 10, 10, 12,
+      12, 12, 12, 12, 12, 10, 12, 10, 10, 10, 10, 12, 12, 10, 12, 12,  7,  7,
+      21,  7,  2,  2,  2,  2,  2,  2,  2,  2, 13, 13, 13, 13, 13, 13, 13, 13,
+      13, 13,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7, 10, 10, 10, 12, 12, 12, 12,  2,  2, 10, 10, 10, 10,
+      12, 12, 10, 12, 12, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+      21, 21, 21, 21, 21, 21, 21, 21, 21, 21,  7,  7,  7,  7, 12, 12,  2,  2,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 10, 10,
+      10, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 12, 10, 12, 12, 21, 21, 21,
+       7,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 13, 13, 13, 13, 13, 13,
+      13, 13, 13, 13,  2,  2,  2,  2,  2,  2, 21, 21, 21, 21, 21, 21, 21, 21,
+      21, 21, 21, 21, 21,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 12,
+      10, 12, 10, 10, 12, 12, 12, 12, 12, 12, 10, 12,  7, 21,  2,  2,  2,  2,
+       2,  2, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 10, 10,
+      12, 12, 12, 12, 10, 12, 12, 12, 12, 12,  2,  2,  2,  2, 13, 13, 13, 13,
+      13, 13, 13, 13, 13, 13, 15, 15, 21, 21, 21, 26,  7,  7,  7,  7,  7,  7,
+       7,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 12, 12, 21,
+       2,  2,  2,  2, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 15, 15, 15, 15,
+      15, 15, 15, 15, 15,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  7,
+       7,  7,  7,  7,  7,  7,  7,  2,  2,  7,  2,  2,  7,  7,  7,  7,  7,  7,
+       7,  7,  2,  7,  7,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 10, 10, 10, 10, 10, 10,
+       2, 10, 10,  2,  2, 12, 12, 10, 12,  7, 10,  7, 10, 12, 21, 21, 21,  2,
+       2,  2,  2,  2,  2,  2,  2,  2, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+       2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7, 10, 10, 10, 12, 12, 12, 12,  2,  2, 12, 12, 10, 10, 10, 10, 12,  7,
+      21,  7, 10,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  7, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7, 12, 12, 12, 12, 12, 12, 10,  7, 12,
+      12, 12, 12, 21, 21, 21, 21, 21, 21, 21, 21, 12,  2,  2,  2,  2,  2,  2,
+       2,  2,  7, 12, 12, 12, 12, 12, 12, 10, 10, 12, 12, 12,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 12, 12, 12, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 10, 12, 12, 21, 21, 21,  7, 21, 21, 21, 21, 21,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7, 10, 12, 12, 12, 12, 12, 12, 12,  2, 12, 12, 12, 12, 12, 12,
+      10, 12,  7, 21, 21, 21, 21, 21,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,  2,  2,  2, 21, 21,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2, 12, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  2, 10,
+      12, 12, 12, 12, 12, 12, 12, 10, 12, 12, 10, 12, 12,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  2,  7,  7,  2,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 12,
+      12, 12, 12, 12, 12,  2,  2,  2, 12,  2, 12, 12,  2, 12, 12, 12, 12, 12,
+      12, 12,  7, 12,  2,  2,  2,  2,  2,  2,  2,  2, 13, 13, 13, 13, 13, 13,
+      13, 13, 13, 13,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  2,  7,
+       7,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 10, 10,
+      10, 10, 10,  2, 12, 12,  2, 10, 10, 12, 10, 12,  7,  2,  2,  2,  2,  2,
+       2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7, 12, 12, 10, 10, 21, 21,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  7,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 26, 26, 26,
+      26, 26, 26, 26, 26, 23, 23, 23, 23, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2, 21, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+      14,  2, 21, 21, 21, 21, 21,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       7,  7,  7,  7,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 21, 21,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  2,  1,  1,  1,  1,  1,  1,  1,  1,  1,  2,
+       2,  2,  2,  2,  2,  2, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  2,  2,
+       2,  2, 21, 21,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  2,  2,  2,  2,  2,  2,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2, 12, 12, 12, 12,
+      12, 21,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 12, 12, 12, 12, 12, 12, 12, 21,
+      21, 21, 21, 21, 26, 26, 26, 26,  6,  6,  6,  6, 21, 26,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  2, 15,
+      15, 15, 15, 15, 15, 15,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2,  2,  2,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 21, 21, 21, 21,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  2,  2,  2,  2, 12,  7, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+      10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+      10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+      10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  2,  2,  2,  2,  2,  2,  2, 12,
+      12, 12, 12,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+      21,  6, 12,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 10, 10,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  6,  6,  6,  6,  2,  6,  6,  6,  6,  6,  6,  6,
+       2,  6,  6,  2,  7,  7,  7,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,
+       7,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       7,  7,  7,  7,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2,
+       2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2, 26, 12,
+      12, 21,  1,  1,  1,  1,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  2,  2, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+      12,  2,  2,  2,  2,  2,  2,  2,  2,  2, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2, 26, 26, 26, 26, 26, 26, 26,  2,  2, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 10, 10, 12, 12, 12, 26, 26, 26, 10, 10, 10, 10, 10,
+      10,  1,  1,  1,  1,  1,  1,  1,  1, 12, 12, 12, 12, 12, 12, 12, 12, 26,
+      26, 12, 12, 12, 12, 12, 12, 12, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 12, 12, 12, 12, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 12, 12, 12, 26,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26,  2,  2,  2,  2,  2,  2,  2,  2,  2, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15,  2,  2,  2,  2,  2,  2,  2,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  5,  5,  5,  5,
+       5,  5,  5,  2,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  9,  2,  9,  9,  2,  2,  9,  2,  2,  9,  9,  2,  2,  9,  9,  9,
+       9,  2,  9,  9,  9,  9,  9,  9,  9,  9,  5,  5,  5,  5,  2,  5,  2,  5,
+       5,  5,  5,  5,  5,  5,  2,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  9,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  9,  9,
+       2,  9,  9,  9,  9,  2,  2,  9,  9,  9,  9,  9,  9,  9,  9,  2,  9,  9,
+       9,  9,  9,  9,  9,  2,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  9,  9,  2,  9,
+       9,  9,  9,  2,  9,  9,  9,  9,  9,  2,  9,  2,  2,  2,  9,  9,  9,  9,
+       9,  9,  9,  2,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  9,  9,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  5,  5,  5,  5,  5,  5,
+       2,  2,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  9,  9, 25,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5, 25,
+       5,  5,  5,  5,  5,  5,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9, 25,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5, 25,  5,  5,  5,  5,  5,  5,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9, 25,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5, 25,  5,  5,  5,  5,  5,  5,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9, 25,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5, 25,  5,  5,  5,  5,  5,  5,
+       9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+       9,  9,  9,  9,  9,  9,  9, 25,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5, 25,  5,  5,
+       5,  5,  5,  5,  9,  5,  2,  2, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+      13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+      13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+      13, 13, 13, 13, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12, 12, 26, 26, 26, 26, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 26, 26, 26, 26, 26,
+      26, 26, 26, 12, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      12, 26, 26, 21, 21, 21, 21, 21,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2, 12, 12, 12, 12, 12,  2, 12, 12, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  7,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  2, 12, 12, 12, 12, 12, 12, 12,  2, 12, 12, 12, 12, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12, 12,  2,  2, 12, 12, 12, 12, 12, 12, 12,
+       2, 12, 12,  2, 12, 12, 12, 12, 12,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  2,  2,  2, 12, 12, 12, 12, 12, 12, 12,  6,
+       6,  6,  6,  6,  6,  6,  2,  2, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+       2,  2,  2,  2,  7, 26,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+      12,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 12, 12, 12, 12, 13, 13,
+      13, 13, 13, 13, 13, 13, 13, 13,  2,  2,  2,  2,  2, 23,  7,  7,  7,  7,
+       7,  7,  7,  2,  7,  7,  7,  7,  2,  7,  7,  2,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  7,  7,  7,  7,  7,  2,  2, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 12, 12, 12, 12, 12, 12, 12,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  9,  9,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+       5,  5,  5,  5,  5,  5, 12, 12, 12, 12, 12, 12, 12,  6,  2,  2,  2,  2,
+      13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  2,  2,  2,  2, 21, 21,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 26, 15, 15, 15, 23, 15, 15, 15, 15,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+      26, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,  2,  2,
+       7,  7,  7,  7,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  7,  7,  2,
+       7,  2,  2,  7,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  7,  7,
+       7,  7,  2,  7,  2,  7,  2,  2,  2,  2,  2,  2,  7,  2,  2,  2,  2,  7,
+       2,  7,  2,  7,  2,  7,  7,  7,  2,  7,  7,  2,  7,  2,  2,  7,  2,  7,
+       2,  7,  2,  7,  2,  7,  2,  7,  7,  2,  7,  2,  2,  7,  7,  7,  7,  2,
+       7,  7,  7,  7,  7,  7,  7,  2,  7,  7,  7,  7,  2,  7,  7,  7,  7,  2,
+       7,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2,  2,  2,  7,
+       7,  7,  2,  7,  7,  7,  7,  7,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 25, 25,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26,  2,  2,  2,  2, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26,  2,  2, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+       2, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,  2, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 15, 15, 15, 15,
+      15, 15, 15, 15, 15, 15, 15, 15, 15, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26,  2,  2,  2,  2, 26, 26, 26, 26, 26, 26,
+      26, 26, 26,  2,  2,  2,  2,  2,  2,  2, 26, 26,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2, 26, 26, 26, 26, 26, 26,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 24, 24, 24, 24, 24,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26,  2,  2,  2,  2,  2, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26,  2,  2,  2, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26,  2,  2,  2, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,  2,
+       2,  2,  2,  2,  2,  2, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+       2,  2,  2,  2, 26,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2, 26, 26, 26, 26, 26, 26, 26, 26,  2,  2,  2,  2,  2,  2,  2,  2,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26,  2,  2,  2,  2,  2,  2, 26, 26,
+      26, 26, 26, 26, 26, 26,  2,  2,  2,  2,  2,  2,  2,  2, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26,  2,  2, 26, 26,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26,  2,  2, 26, 26, 26, 26, 26,  2,  2,  2, 26, 26, 26, 26,
+      26,  2,  2,  2, 26, 26, 26, 26, 26, 26, 26,  2,  2,  2,  2,  2,  2,  2,
+       2,  2, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,  2,  2,  2, 26, 26,
+      26, 26, 26, 26, 26, 26, 26, 26, 26,  2,  2,  2,  2,  2, 26, 26, 26, 26,
+      26, 26,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26,  2,  2,  2,  2,  2,  2, 26, 26, 26, 26, 26, 26, 26, 26,
+       2,  2,  2,  2,  2,  2,  2,  2, 26, 26, 26, 26, 26, 26, 26,  2,  2,  2,
+       2,  2,  2,  2,  2,  2, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26, 26, 26, 26, 26, 26,  2, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+      26, 26,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  2,  2,  2,  2,  2,  2,  7,  7,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,
+       7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+       7,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  1,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+       1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+       1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1, 12, 12, 12, 12,
+      12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,  2,  2,  2,  2,  2,  2,
+       2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  3,  3,  3,  3,  3,  3,  3,  3,
+       3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,
+       3,  3,  3,  3,  2,  2,
+    };
+}
+
+qre::general_category qre::category(char32_t ch)
+{
+  if(ch > max_char)
+    return general_category::Cn;
+  unsigned int block = blocks[groups[ch / 1024] * 32 + ch / 32 % 32];
+  return static_cast<general_category>(categories[block * 32 + ch % 32]);
+}
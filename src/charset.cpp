@@ -0,0 +1,133 @@
+/*
+ * Copyright 2016 Nils Christopher Brause
+ *
+ * This file is part of libqre.
+ *
+ * libqre is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libqre is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libqre.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <qre.hpp>
+#include <algorithm>
+
+qre::charset_t qre::charset_normalise(charset_t set)
+{
+  std::sort(set.begin(), set.end());
+
+  charset_t result;
+  for(auto &r : set)
+    {
+      // merge overlapping and adjacent ranges
+      if(result.size() && r.begin <= result.back().end + 1)
+        result.back().end = std::max(result.back().end, r.end);
+      else
+        result.push_back(r);
+    }
+  return result;
+}
+
+qre::charset_t qre::charset_union(const charset_t &a, const charset_t &b)
+{
+  charset_t result = a;
+  result.insert(result.end(), b.begin(), b.end());
+  return charset_normalise(result);
+}
+
+qre::charset_t qre::charset_invert(const charset_t &a)
+{
+  charset_t result;
+  char32_t next = 0;
+  for(auto &r : a)
+    {
+      if(r.begin > next)
+        result.push_back({ next, r.begin - 1 });
+      next = r.end + 1;
+    }
+  if(next <= max_char)
+    result.push_back({ next, max_char });
+  return result;
+}
+
+qre::charset_t qre::charset_intersect(const charset_t &a, const charset_t &b)
+{
+  charset_t result;
+  auto ita = a.begin();
+  auto itb = b.begin();
+  while(ita != a.end() && itb != b.end())
+    {
+      char32_t begin = std::max(ita->begin, itb->begin);
+      char32_t end = std::min(ita->end, itb->end);
+      if(begin <= end)
+        result.push_back({ begin, end });
+      if(ita->end < itb->end)
+        ita++;
+      else
+        itb++;
+    }
+  return result;
+}
+
+bool qre::charset_disjoint(const charset_t &a, const charset_t &b)
+{
+  return charset_intersect(a, b).empty();
+}
+
+qre::charset_t qre::charset(const test_t &test, bool multiline)
+{
+  charset_t result;
+
+  switch(test.type)
+    {
+    case test_t::test_type::any:
+      if(multiline)
+        result = charset_invert({ { '\n', '\n' } });
+      else
+        result.push_back({ 0, max_char });
+      break;
+
+    case test_t::test_type::newline:
+      // only "\N" consumes exactly one character
+      assert(test.neg);
+      result = charset_invert({ { '\n', '\n' }, { '\r', '\r' } });
+      break;
+
+    case test_t::test_type::character:
+      for(auto &c : test.chars)
+        result.push_back({ c, c });
+      result.insert(result.end(), test.ranges.begin(), test.ranges.end());
+      if(test.categories)
+        {
+          charset_t cats = category_charset(test.categories);
+          result.insert(result.end(), cats.begin(), cats.end());
+        }
+      result = charset_normalise(result);
+
+      if(test.neg)
+        result = charset_invert(result);
+
+      for(auto &sub : test.subtractions)
+        result = charset_intersect(result, charset_invert(charset(sub, multiline)));
+
+      for(auto &itr : test.intersections)
+        result = charset_intersect(result, charset(itr, multiline));
+      break;
+
+    default:
+      throw std::runtime_error("test does not consume a single character.");
+      break;
+    }
+
+  return result;
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2016 Nils Christopher Brause
+ *
+ * This file is part of libqre.
+ *
+ * libqre is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libqre is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libqre.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <qre.hpp>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define QRE_X86
+#include <immintrin.h>
+#endif
+
+qre::byte_class_t qre::byte_class(const std::vector<bool> &bytes)
+{
+  byte_class_t result = {};
+  for(unsigned int ch = 0; ch < 256; ch++)
+    if(bytes[ch])
+      ((ch & 0x80) ? result.high : result.low)[ch & 0x0F] |= 1 << ((ch >> 4) & 7);
+  return result;
+}
+
+#ifdef QRE_X86
+// Shuffles give zero for indices with the top bit set, so each table answers
+// for its half of the bytes only. Returns the bytes outside the class.
+__attribute__((target("ssse3")))
+static inline unsigned int outside_ssse3(__m128i input, __m128i low, __m128i high,
+                                         __m128i bits)
+{
+  __m128i row = _mm_or_si128(_mm_shuffle_epi8(low, input),
+                             _mm_shuffle_epi8(high, _mm_xor_si128(input, _mm_set1_epi8(-0x80))));
+  __m128i bit = _mm_shuffle_epi8(bits, _mm_and_si128(_mm_srli_epi16(input, 4),
+                                                     _mm_set1_epi8(0x0F)));
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(row, bit), _mm_setzero_si128()));
+}
+
+__attribute__((target("avx2")))
+static inline unsigned int outside_avx2(__m256i input, __m256i low, __m256i high,
+                                        __m256i bits)
+{
+  __m256i row = _mm256_or_si256(_mm256_shuffle_epi8(low, input),
+                                _mm256_shuffle_epi8(high, _mm256_xor_si256(input, _mm256_set1_epi8(-0x80))));
+  __m256i bit = _mm256_shuffle_epi8(bits, _mm256_and_si256(_mm256_srli_epi16(input, 4),
+                                                           _mm256_set1_epi8(0x0F)));
+  return _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(row, bit),
+                                                _mm256_setzero_si256()));
+}
+
+static const uint8_t bit_table[16] =
+  { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+
+__attribute__((target("ssse3")))
+static size_t run_ssse3(const uint8_t *low_table, const uint8_t *high_table,
+                        const uint8_t *data, size_t n, bool reverse)
+{
+  const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(low_table));
+  const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(high_table));
+  const __m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bit_table));
+  size_t run = 0;
+  for(; run + 16 <= n; run += 16)
+    {
+      const uint8_t *p = reverse ? data + n - run - 16 : data + run;
+      unsigned int outside = outside_ssse3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)),
+                                           low, high, bits);
+      if(outside)
+        return run + (reverse ? __builtin_clz(outside) - 16 : __builtin_ctz(outside));
+    }
+  return run;
+}
+
+__attribute__((target("avx2")))
+static size_t run_avx2(const uint8_t *low_table, const uint8_t *high_table,
+                       const uint8_t *data, size_t n, bool reverse)
+{
+  const __m256i low = _mm256_broadcastsi128_si256(
+    _mm_loadu_si128(reinterpret_cast<const __m128i*>(low_table)));
+  const __m256i high = _mm256_broadcastsi128_si256(
+    _mm_loadu_si128(reinterpret_cast<const __m128i*>(high_table)));
+  const __m256i bits = _mm256_broadcastsi128_si256(
+    _mm_loadu_si128(reinterpret_cast<const __m128i*>(bit_table)));
+  size_t run = 0;
+  for(; run + 32 <= n; run += 32)
+    {
+      const uint8_t *p = reverse ? data + n - run - 32 : data + run;
+      unsigned int outside = outside_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)),
+                                          low, high, bits);
+      if(outside)
+        return run + (reverse ? __builtin_clz(outside) : __builtin_ctz(outside));
+    }
+  return run;
+}
+#endif
+
+// whole blocks of class bytes, the rest is left to the caller
+static size_t run_blocks(const uint8_t *low_table, const uint8_t *high_table,
+                         const uint8_t *data, size_t n, bool reverse)
+{
+#ifdef QRE_X86
+  static const bool avx2 = __builtin_cpu_supports("avx2");
+  static const bool ssse3 = __builtin_cpu_supports("ssse3");
+  if(avx2)
+    return run_avx2(low_table, high_table, data, n, reverse);
+  if(ssse3)
+    return run_ssse3(low_table, high_table, data, n, reverse);
+#endif
+  return 0;
+}
+
+size_t qre::class_run(const byte_class_t &c, const uint8_t *data, size_t n)
+{
+  size_t run = run_blocks(c.low, c.high, data, n, false);
+  while(run < n && byte_class_has(c, data[run]))
+    run++;
+  return run;
+}
+
+size_t qre::class_run_reverse(const byte_class_t &c, const uint8_t *data, size_t n)
+{
+  size_t run = run_blocks(c.low, c.high, data, n, true);
+  while(run < n && byte_class_has(c, data[n-run-1]))
+    run++;
+  return run;
+}
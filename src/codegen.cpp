@@ -0,0 +1,416 @@
+/*
+ * Copyright 2016 Nils Christopher Brause
+ *
+ * This file is part of libqre.
+ *
+ * libqre is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libqre is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libqre.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+#include <qre.hpp>
+
+// Generated matchers share this backtracker, which works like
+// qre::backtrack() on the tables of a pattern.
+static const char *runtime = R"(#ifndef QRE_GENERATED_RUNTIME
+#define QRE_GENERATED_RUNTIME
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <qre.hpp>
+
+namespace qre_generated
+{
+  enum test_type : uint8_t { epsilon, bol, eol, newline, bytes };
+
+  struct capture
+  {
+    bool named;
+    uint32_t number;
+    const char *name;
+  };
+
+  struct transition
+  {
+    test_type type;
+    uint16_t set[2]; // byte set per multiline mode
+    uint32_t target;
+  };
+
+  struct state
+  {
+    bool begin_capture;
+    bool nonstop;
+    uint32_t captures, ncaptures; // range of the active capture groups
+    uint32_t transitions, ntransitions;
+  };
+
+  struct pattern
+  {
+    const state *states;
+    const transition *transitions;
+    const capture *captures;
+    const capture *groups; // every capture group of the pattern
+    uint32_t ngroups;
+    const uint8_t (*sets)[32];
+    uint32_t start, final;
+    const char *prefix, *prefix_mask; // letters in lower case, 0x20 for either
+    size_t prefix_length;
+  };
+
+  // next occurrence of the literal prefix at or after 'pos'
+  inline bool skip(const pattern &p, const char *data, size_t length, size_t &pos)
+  {
+    for(; pos + p.prefix_length <= length; pos++)
+      {
+        size_t c = 0;
+        while(c < p.prefix_length && (data[pos+c] | p.prefix_mask[c]) == p.prefix[c])
+          c++;
+        if(c == p.prefix_length)
+          return true;
+      }
+    return false;
+  }
+
+  inline bool test(const pattern &p, const transition &t, const char *data,
+                   size_t length, size_t &pos, bool multiline)
+  {
+    switch(t.type)
+      {
+      case epsilon:
+        return true;
+      case bol:
+        return pos == 0 || (multiline && pos < length && data[pos-1] == '\n');
+      case eol:
+        if(pos == length)
+          return true;
+        if(multiline && data[pos] == '\n')
+          {
+            pos++;
+            return true;
+          }
+        return false;
+      case newline:
+        if(pos == length || (data[pos] != '\n' && data[pos] != '\r'))
+          return false;
+        pos += data[pos] == '\r' && pos+1 < length && data[pos+1] == '\n' ? 2 : 1;
+        return true;
+      default:
+        {
+          if(pos == length)
+            return false;
+          uint8_t ch = data[pos];
+          if(!(p.sets[t.set[multiline]][ch / 8] & (1 << (ch % 8))))
+            return false;
+          pos++;
+          return true;
+        }
+      }
+  }
+
+  inline std::string &last(const capture &c, qre::match &result)
+  {
+    if(c.named)
+      return result.named_sub.at(c.name).back();
+    return result.sub.at(c.number).back();
+  }
+
+  inline bool search(const pattern &p, const char *data, size_t length,
+                     qre::match &result, qre::match_flag flags)
+  {
+    const uint8_t f = static_cast<uint8_t>(flags);
+    auto flag = [f] (qre::match_flag flag) -> bool
+      {
+        return f & static_cast<uint8_t>(flag);
+      };
+    bool fix_left = flag(qre::match_flag::fix_left);
+    bool fix_right = flag(qre::match_flag::fix_right);
+    bool multiline = flag(qre::match_flag::multiline);
+    if(flag(qre::match_flag::partial) || flag(qre::match_flag::longest))
+      throw std::runtime_error("Generated matchers do not support partial or longest matches.");
+    // bytes and characters coincide in ASCII input
+    if(flag(qre::match_flag::utf8) || flag(qre::match_flag::assume_valid_utf8))
+      for(size_t c = 0; c < length; c++)
+        if(data[c] & 0x80)
+          throw std::runtime_error("Generated matchers do not support UTF-8 input.");
+
+    result.pos = 0;
+    result.str.clear();
+    result.sub.clear();
+    result.named_sub.clear();
+    result.limit = qre::limit_type::none;
+    result.type = qre::match_type::none;
+
+    size_t begin = 0;
+    if(!fix_left && p.prefix_length && !skip(p, data, length, begin))
+      return false;
+
+    struct frame
+    {
+      uint32_t state;
+      uint32_t transition;
+      size_t pos;
+    };
+    std::vector<frame> history;
+    frame current = { p.start, 0, begin };
+    result.pos = begin;
+
+    while(true)
+      {
+        const state &s = p.states[current.state];
+        if(current.state == p.final)
+          {
+            if(!fix_right || current.pos == length)
+              {
+                result.type = qre::match_type::full;
+                return true;
+              }
+          }
+        else if(current.transition < s.ntransitions)
+          {
+            size_t newpos = current.pos;
+            if(s.begin_capture)
+              {
+                const capture &c = p.captures[s.captures + s.ncaptures - 1];
+                if(c.named)
+                  result.named_sub[c.name].push_back("");
+                else
+                  result.sub[c.number].push_back("");
+              }
+
+            const transition &t = p.transitions[s.transitions + current.transition];
+            if(test(p, t, data, length, newpos, multiline))
+              {
+                for(uint32_t c = s.captures; c < s.captures + s.ncaptures; c++)
+                  last(p.captures[c], result).append(data + current.pos, newpos - current.pos);
+                result.str.append(data + current.pos, newpos - current.pos);
+                history.push_back(current);
+                current = { t.target, 0, newpos };
+              }
+            else
+              current.transition++;
+            continue;
+          }
+
+        // going back in history, through atomic groups at once
+        if(history.size())
+          do
+            {
+              size_t newpos = current.pos;
+              current = history.back();
+              current.transition++;
+              history.pop_back();
+
+              const state &r = p.states[current.state];
+              size_t n = newpos - current.pos;
+              for(uint32_t c = r.captures; c < r.captures + r.ncaptures; c++)
+                last(p.captures[c], result).erase(last(p.captures[c], result).length() - n, n);
+              if(r.begin_capture)
+                {
+                  const capture &c = p.captures[r.captures + r.ncaptures - 1];
+                  if(c.named)
+                    result.named_sub.at(c.name).pop_back();
+                  else
+                    result.sub.at(c.number).pop_back();
+                }
+              result.str.erase(result.str.length() - n, n);
+            }
+          while(p.states[current.state].nonstop && history.size());
+        // next starting point
+        else if(!fix_left && current.pos < length)
+          {
+            current.transition = 0;
+            current.pos++;
+            if(p.prefix_length && !skip(p, data, length, current.pos))
+              return false;
+            result.pos = current.pos;
+          }
+        else
+          return false;
+      }
+  }
+
+  inline bool match(const pattern &p, const char *data, size_t length,
+                    qre::match &result, qre::match_flag flags)
+  {
+    bool found = search(p, data, length, result, flags);
+    // groups that took no part in the match get an entry, like in the library
+    for(uint32_t c = 0; c < p.ngroups; c++)
+      if(p.groups[c].named)
+        result.named_sub[p.groups[c].name];
+      else
+        result.sub[p.groups[c].number];
+    return found;
+  }
+}
+
+#endif // QRE_GENERATED_RUNTIME
+)";
+
+// string literal that survives any bytes
+static std::string quote(const std::string &str)
+{
+  std::ostringstream result;
+  result << '"';
+  for(unsigned char ch : str)
+    if(ch >= 0x20 && ch < 0x7F && ch != '"' && ch != '\\' && ch != '?')
+      result << ch;
+    else
+      result << '\\' << static_cast<char>('0' + (ch >> 6))
+             << static_cast<char>('0' + ((ch >> 3) & 7))
+             << static_cast<char>('0' + (ch & 7));
+  result << '"';
+  return result.str();
+}
+
+std::string qre::generate(const std::string &name) const
+{
+  // the name becomes a namespace and a function
+  bool identifier = !name.empty() && !std::isdigit(static_cast<unsigned char>(name[0]));
+  for(unsigned char ch : name)
+    identifier = identifier && (std::isalnum(ch) || ch == '_');
+  if(!identifier)
+    throw std::runtime_error("Invalid function name: " + name);
+
+  std::ostringstream out;
+  std::ostringstream table_states, table_transitions, table_captures, table_sets;
+  std::ostringstream table_groups;
+
+  // byte sets of the single character tests per multiline mode
+  std::map<std::vector<uint8_t>, unsigned int> sets;
+  auto set_index = [&] (const test_t &test, bool multiline) -> unsigned int
+    {
+      std::vector<uint8_t> bitmap(32, 0);
+      for(auto &r : charset(test, multiline))
+        for(char32_t ch = r.begin; ch <= std::min<char32_t>(r.end, 0xFF); ch++)
+          bitmap[ch / 8] |= 1 << (ch % 8);
+      auto it = sets.find(bitmap);
+      if(it != sets.end())
+        return it->second;
+      table_sets << "      {";
+      for(unsigned int c = 0; c < 32; c++)
+        table_sets << (c ? ", " : " ") << static_cast<unsigned int>(bitmap[c]);
+      table_sets << " },\n";
+      unsigned int index = sets.size();
+      sets[bitmap] = index;
+      return index;
+    };
+
+  unsigned int ntransitions = 0;
+  unsigned int ncaptures = 0;
+  for(auto &state : states)
+    {
+      table_states << "      { " << state.begin_capture << ", " << state.nonstop << ", "
+                   << ncaptures << ", " << state.captures.size() << ", "
+                   << ntransitions << ", " << state.transitions.size() << " },\n";
+
+      for(auto &c : state.captures)
+        table_captures << "      { " << c.named << ", "
+                       << static_cast<uint32_t>(c.number) << ", "
+                       << quote(c.name) << " },\n";
+      ncaptures += state.captures.size();
+
+      for(auto &t : state.transitions)
+        {
+          const char *type;
+          unsigned int set[2] = { 0, 0 };
+          switch(t.test.type)
+            {
+            case test_t::test_type::epsilon:
+              type = "epsilon";
+              break;
+            case test_t::test_type::bol:
+              type = "bol";
+              break;
+            case test_t::test_type::eol:
+              type = "eol";
+              break;
+            case test_t::test_type::backref:
+              throw std::runtime_error("Backreferences cannot be generated.");
+            default:
+              if(t.test.type == test_t::test_type::newline && !t.test.neg)
+                {
+                  type = "newline";
+                  break;
+                }
+              type = "bytes";
+              set[0] = set_index(t.test, false);
+              set[1] = set_index(t.test, true);
+              break;
+            }
+          table_transitions << "      { qre_generated::" << type << ", { "
+                            << set[0] << ", " << set[1] << " }, " << t.state << " },\n";
+        }
+      ntransitions += state.transitions.size();
+    }
+
+  for(auto &c : capture_groups)
+    table_groups << "      { " << c.named << ", "
+                 << static_cast<uint32_t>(c.number) << ", "
+                 << quote(c.name) << " },\n";
+
+  // arrays must not be empty
+  if(!ntransitions)
+    table_transitions << "      { qre_generated::epsilon, { 0, 0 }, 0 },\n";
+  if(!ncaptures)
+    table_captures << "      { false, 0, \"\" },\n";
+  if(capture_groups.empty())
+    table_groups << "      { false, 0, \"\" },\n";
+  if(sets.empty())
+    table_sets << "      { 0 },\n";
+
+  out << runtime << "\n"
+      << "namespace qre_generated\n"
+      << "{\n"
+      << "  namespace " << name << "\n"
+      << "  {\n"
+      << "    static const char source[] = " << quote(source) << ";\n"
+      << "    static const qre::compile_flag flags = qre::compile_flag::"
+      << (icase ? "icase" : "none") << ";\n\n"
+      << "    static const qre_generated::state states[] =\n    {\n"
+      << table_states.str() << "    };\n"
+      << "    static const qre_generated::transition transitions[] =\n    {\n"
+      << table_transitions.str() << "    };\n"
+      << "    static const qre_generated::capture captures[] =\n    {\n"
+      << table_captures.str() << "    };\n"
+      << "    static const qre_generated::capture groups[] =\n    {\n"
+      << table_groups.str() << "    };\n"
+      << "    static const uint8_t sets[][32] =\n    {\n"
+      << table_sets.str() << "    };\n\n"
+      << "    static const qre_generated::pattern pattern =\n"
+      << "      { states, transitions, captures, groups, "
+      << capture_groups.size() << ", sets, "
+      << the_chain.begin << ", " << the_chain.end << ",\n"
+      << "        " << quote(prefix[false]) << ", " << quote(prefix_mask[false]) << ", "
+      << prefix[false].length() << " };\n"
+      << "  }\n"
+      << "}\n\n"
+      << "inline bool " << name << "(const char *data, size_t length, qre::match &result,\n"
+      << "                 qre::match_flag flags = qre::match_flag::none)\n"
+      << "{\n"
+      << "  return qre_generated::match(qre_generated::" << name << "::pattern,\n"
+      << "                              data, length, result, flags);\n"
+      << "}\n\n"
+      << "inline bool " << name << "(const std::string &str, qre::match &result,\n"
+      << "                 qre::match_flag flags = qre::match_flag::none)\n"
+      << "{\n"
+      << "  return " << name << "(str.data(), str.length(), result, flags);\n"
+      << "}\n";
+
+  return out.str();
+}
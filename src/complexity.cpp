@@ -0,0 +1,863 @@
+/*
+ * Copyright 2016 Nils Christopher Brause
+ *
+ * This file is part of libqre.
+ *
+ * libqre is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libqre is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libqre.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <queue>
+#include <unordered_map>
+#include <qre.hpp>
+
+// The backtracker tries every path through the state graph that reads the
+// input. Its running time therefore depends on how ambiguous the graph is.
+//
+// The graph is first reduced to nodes that are entered by consuming
+// transitions. An edge between two nodes stands for one path of zero-width
+// transitions followed by one consuming transition; more than one such path
+// makes the edge 'multiple'. Zero-width assertions are assumed to succeed,
+// except for the beginning of the string outside multiline mode, and
+// backreferences to consume any character, so the result is an upper bound.
+// Choices inside atomic groups are not retried and do not count.
+//
+// - Exponential: some node can be left and reentered on the same word along
+//   two different paths. Pairs of nodes reading the same characters are
+//   explored for such a cycle.
+// - Polynomial: two nodes p != q in different strongly connected components
+//   have paths p->p, p->q and q->q on the same word. Triples of nodes are
+//   explored for such paths. The degree is the number of nodes in the
+//   longest chain from p that loop on the same word and lead from one to
+//   the next on it, so that repeating that word is ambiguous at each step.
+// - Linear otherwise.
+//
+// Ambiguity only slows the backtracker down if the input is not matched, so
+// it is reported with an attack string that no path through the graph
+// accepts: the word leading to the node, the word repeated and a suffix. If
+// no such suffix is found, the result is unknown.
+//
+// In search mode the backtracker starts at every position, which is modelled
+// by a start node looping on any character.
+//
+// Counted repetitions are unrolled and have no cycles, but large bounds
+// multiply the work just the same. Patterns with such repetitions are
+// analysed with them replaced by loops.
+
+struct qre::complexity_graph
+{
+  struct edge_t
+  {
+    unsigned int target;
+    charset_t set;
+    bool multiple; // more than one path of zero-width transitions
+    bool atomic; // taken inside an atomic group, never retried
+  };
+
+  std::vector<std::vector<edge_t>> edges; // per node
+  std::vector<bool> accepting; // per node, at the end
+  std::vector<bool> accepting_inside; // per node, without end of line tests
+  unsigned int start = 0;
+  unsigned int search = ~0u; // start looping on any character
+  bool fix_right = false; // only matches up to the end count
+  bool multiline = false;
+
+  std::vector<unsigned int> scc; // component per node
+  std::vector<bool> cyclic; // per component
+
+  // budget for explored pairs and triples
+  size_t budget = 1 << 22;
+
+  // strongly connected components in reverse topological order
+  static std::vector<unsigned int>
+  components(const std::vector<std::vector<unsigned int>> &graph,
+             unsigned int &count);
+
+  // representative character
+  static char32_t pick(const charset_t &set);
+  static bool contains(const charset_t &set, char32_t ch);
+
+  // shortest word from node 'from' to node 'to'
+  bool path(unsigned int from, unsigned int to, std::u32string &word) const;
+
+  // nodes reading the same words, for the whole graph or one component
+  struct pair_graph
+  {
+    struct edge_t
+    {
+      unsigned int target;
+      char32_t ch;
+      bool diverging; // different edges from a diagonal pair
+    };
+
+    std::vector<std::pair<unsigned int, unsigned int>> pairs;
+    std::vector<std::vector<edge_t>> edges; // per pair
+    std::vector<unsigned int> diagonal; // pairs of equal nodes
+    std::vector<unsigned int> scc; // component per pair
+    unsigned int count = 0; // number of components
+
+    bool on_diagonal(unsigned int p) const { return pairs[p].first == pairs[p].second; }
+    std::u32string path(unsigned int from, unsigned int to) const;
+  };
+
+  bool pairs(unsigned int component, pair_graph &pg);
+
+  // two different cycles on the same word through a node of 'component'
+  bool ambiguous_cycle(unsigned int component, unsigned int &node,
+                       std::u32string &word);
+
+  // p->p, p->q and q->q on the same word
+  bool ambiguous_pair(unsigned int p, unsigned int q, std::u32string &word);
+
+  // nodes reached from 'nodes' on a character
+  void read(std::vector<bool> &nodes, char32_t ch) const;
+  // some of 'nodes' accepts at the end or before 'ch'
+  bool accepts(const std::vector<bool> &nodes, bool end, char32_t ch = 0) const;
+
+  // number of nodes in the longest chain from 'p' of nodes that loop on
+  // repetitions of 'pump' and lead to each other on them
+  unsigned int chain(unsigned int p, const std::u32string &pump) const;
+
+  // input reaching 'node', followed by 'pump' repeated and 'suffix', that is
+  // not matched
+  bool attack(unsigned int node, const std::u32string &pump,
+              std::u32string &prefix, std::u32string &suffix) const;
+};
+
+std::vector<unsigned int>
+qre::complexity_graph::components(const std::vector<std::vector<unsigned int>> &graph,
+                                  unsigned int &count)
+{
+  // iterative version of Tarjan's algorithm
+  const unsigned int none = ~0u;
+  std::vector<unsigned int> index(graph.size(), none), low(graph.size(), 0);
+  std::vector<unsigned int> result(graph.size(), none);
+  std::vector<unsigned int> stack;
+  std::vector<std::pair<unsigned int, unsigned int>> calls; // node, next edge
+  unsigned int next = 0;
+  count = 0;
+
+  for(unsigned int root = 0; root < graph.size(); root++)
+    {
+      if(index[root] != none)
+        continue;
+      calls.push_back({ root, 0 });
+      while(calls.size())
+        {
+          unsigned int node = calls.back().first;
+          unsigned int &edge = calls.back().second;
+          if(edge == 0 && index[node] == none)
+            {
+              index[node] = low[node] = next++;
+              stack.push_back(node);
+            }
+          if(edge < graph[node].size())
+            {
+              unsigned int target = graph[node][edge++];
+              if(index[target] == none)
+                calls.push_back({ target, 0 });
+              else if(result[target] == none)
+                low[node] = std::min(low[node], index[target]);
+              continue;
+            }
+
+          // all successors visited
+          if(low[node] == index[node])
+            {
+              unsigned int member;
+              do
+                {
+                  member = stack.back();
+                  stack.pop_back();
+                  result[member] = count;
+                }
+              while(member != node);
+              count++;
+            }
+          calls.pop_back();
+          if(calls.size())
+            low[calls.back().first] = std::min(low[calls.back().first], low[node]);
+        }
+    }
+  return result;
+}
+
+char32_t qre::complexity_graph::pick(const charset_t &set)
+{
+  // prefer letters, digits and other printable ASCII characters
+  for(auto &r : { char_range{ 'a', 'z' }, char_range{ 'A', 'Z' },
+        char_range{ '0', '9' }, char_range{ '!', '~' } })
+    for(auto &s : set)
+      if(s.begin <= r.end && r.begin <= s.end)
+        return std::max(s.begin, r.begin);
+  return set.front().begin;
+}
+
+bool qre::complexity_graph::contains(const charset_t &set, char32_t ch)
+{
+  auto it = std::upper_bound(set.begin(), set.end(), ch,
+                             [] (char32_t c, const char_range &r) { return c < r.begin; });
+  return it != set.begin() && (it-1)->end >= ch;
+}
+
+bool qre::complexity_graph::path(unsigned int from, unsigned int to,
+                                 std::u32string &word) const
+{
+  const unsigned int none = ~0u;
+  std::vector<unsigned int> parent(edges.size(), none);
+  std::vector<char32_t> chars(edges.size());
+  std::queue<unsigned int> todo;
+  parent[from] = from;
+  todo.push(from);
+  while(todo.size() && parent[to] == none)
+    {
+      unsigned int node = todo.front();
+      todo.pop();
+      for(auto &e : edges[node])
+        if(parent[e.target] == none)
+          {
+            parent[e.target] = node;
+            chars[e.target] = pick(e.set);
+            todo.push(e.target);
+          }
+    }
+  if(parent[to] == none)
+    return false;
+
+  word.clear();
+  for(unsigned int node = to; node != from; node = parent[node])
+    word.push_back(chars[node]);
+  std::reverse(word.begin(), word.end());
+  return true;
+}
+
+bool qre::complexity_graph::pairs(unsigned int component, pair_graph &pg)
+{
+  std::unordered_map<uint64_t, unsigned int> index;
+  auto pair_index = [&] (unsigned int a, unsigned int b) -> unsigned int
+    {
+      uint64_t key = static_cast<uint64_t>(a) << 32 | b;
+      auto it = index.find(key);
+      if(it != index.end())
+        return it->second;
+      index[key] = pg.pairs.size();
+      pg.pairs.push_back({ a, b });
+      pg.edges.emplace_back();
+      return pg.pairs.size() - 1;
+    };
+  auto inside = [this, component] (unsigned int n)
+    { return component == ~0u || scc[n] == component; };
+
+  for(unsigned int n = 0; n < edges.size(); n++)
+    if(inside(n))
+      pg.diagonal.push_back(pair_index(n, n));
+  for(unsigned int p = 0; p < pg.pairs.size(); p++)
+    {
+      if(pg.pairs.size() > budget)
+        {
+          budget = 0;
+          return false;
+        }
+      unsigned int a = pg.pairs[p].first, b = pg.pairs[p].second;
+      for(unsigned int i = 0; i < edges[a].size(); i++)
+        for(unsigned int j = 0; j < edges[b].size(); j++)
+          {
+            const edge_t &ea = edges[a][i], &eb = edges[b][j];
+            if(!inside(ea.target) || !inside(eb.target))
+              continue;
+            // alternatives inside atomic groups are not retried
+            if(a == b && i != j && ea.atomic && eb.atomic)
+              continue;
+            charset_t set = charset_intersect(ea.set, eb.set);
+            if(set.empty())
+              continue;
+            bool diverging = a == b && (i != j || (ea.multiple && !ea.atomic));
+            unsigned int target = pair_index(ea.target, eb.target);
+            pg.edges[p].push_back({ target, pick(set), diverging });
+          }
+    }
+  budget -= pg.pairs.size();
+
+  std::vector<std::vector<unsigned int>> plain(pg.edges.size());
+  for(unsigned int p = 0; p < pg.edges.size(); p++)
+    for(auto &e : pg.edges[p])
+      plain[p].push_back(e.target);
+  pg.scc = components(plain, pg.count);
+  return true;
+}
+
+std::u32string qre::complexity_graph::pair_graph::path(unsigned int from,
+                                                       unsigned int to) const
+{
+  // shortest word inside the component of 'from'
+  std::vector<unsigned int> parent(edges.size(), ~0u);
+  std::vector<char32_t> chars(edges.size());
+  std::queue<unsigned int> todo;
+  parent[from] = from;
+  todo.push(from);
+  while(todo.size() && parent[to] == ~0u)
+    {
+      unsigned int n = todo.front();
+      todo.pop();
+      for(auto &f : edges[n])
+        if(parent[f.target] == ~0u && scc[f.target] == scc[from])
+          {
+            parent[f.target] = n;
+            chars[f.target] = f.ch;
+            todo.push(f.target);
+          }
+    }
+  std::u32string result;
+  for(unsigned int n = to; n != from; n = parent[n])
+    result.push_back(chars[n]);
+  std::reverse(result.begin(), result.end());
+  return result;
+}
+
+bool qre::complexity_graph::ambiguous_cycle(unsigned int component,
+                                            unsigned int &node,
+                                            std::u32string &word)
+{
+  pair_graph pg;
+  if(!pairs(component, pg))
+    return false;
+
+  // a component of the pair graph with a diagonal pair and a way off the
+  // diagonal contains two different cycles
+  std::vector<unsigned int> diagonal(pg.count, ~0u);
+  for(auto d : pg.diagonal)
+    diagonal[pg.scc[d]] = d;
+  for(unsigned int p = 0; p < pg.edges.size(); p++)
+    for(auto &e : pg.edges[p])
+      {
+        if(pg.scc[e.target] != pg.scc[p] || diagonal[pg.scc[p]] == ~0u)
+          continue;
+        if(!e.diverging && pg.on_diagonal(e.target))
+          continue;
+
+        // cycle: diagonal -> p -e-> target -> diagonal
+        unsigned int d = diagonal[pg.scc[p]];
+        node = pg.pairs[d].first;
+        word = pg.path(d, p);
+        word.push_back(e.ch);
+        word += pg.path(e.target, d);
+        return true;
+      }
+  return false;
+}
+
+bool qre::complexity_graph::ambiguous_pair(unsigned int p, unsigned int q,
+                                           std::u32string &word)
+{
+  // triples (a, b, c) reading the same word from (p, p, q) with 'a' staying
+  // in the component of p and 'c' in the component of q
+  const uint64_t n = edges.size();
+  std::unordered_map<uint64_t, std::pair<uint64_t, char32_t>> parent;
+  std::queue<uint64_t> todo;
+  auto key = [n] (uint64_t a, uint64_t b, uint64_t c) { return (a * n + b) * n + c; };
+  uint64_t from = key(p, p, q), to = key(p, q, q);
+  parent[from] = { from, 0 };
+  todo.push(from);
+
+  while(todo.size() && !parent.count(to))
+    {
+      if(parent.size() > budget)
+        {
+          budget = 0;
+          return false;
+        }
+      uint64_t t = todo.front();
+      todo.pop();
+      unsigned int a = t / n / n, b = t / n % n, c = t % n;
+      for(auto &ea : edges[a])
+        {
+          if(scc[ea.target] != scc[p])
+            continue;
+          for(auto &eb : edges[b])
+            {
+              charset_t ab = charset_intersect(ea.set, eb.set);
+              if(ab.empty())
+                continue;
+              for(auto &ec : edges[c])
+                {
+                  if(scc[ec.target] != scc[q])
+                    continue;
+                  charset_t abc = charset_intersect(ab, ec.set);
+                  if(abc.empty())
+                    continue;
+                  uint64_t next = key(ea.target, eb.target, ec.target);
+                  if(parent.count(next))
+                    continue;
+                  parent[next] = { t, pick(abc) };
+                  todo.push(next);
+                }
+            }
+        }
+    }
+  budget -= std::min(budget, parent.size());
+  if(!parent.count(to))
+    return false;
+
+  word.clear();
+  for(uint64_t t = to; t != from; t = parent[t].first)
+    word.push_back(parent[t].second);
+  std::reverse(word.begin(), word.end());
+  return true;
+}
+
+void qre::complexity_graph::read(std::vector<bool> &nodes, char32_t ch) const
+{
+  std::vector<bool> next(edges.size(), false);
+  for(unsigned int n = 0; n < edges.size(); n++)
+    if(nodes[n])
+      for(auto &e : edges[n])
+        if(contains(e.set, ch))
+          next[e.target] = true;
+  nodes.swap(next);
+}
+
+bool qre::complexity_graph::accepts(const std::vector<bool> &nodes, bool end,
+                                    char32_t ch) const
+{
+  // end of line tests pass at the end and in multiline mode before a newline
+  bool eol = end || (multiline && ch == '\n');
+  for(unsigned int n = 0; n < edges.size(); n++)
+    if(nodes[n] && (eol ? accepting[n] : accepting_inside[n]))
+      return true;
+  return false;
+}
+
+unsigned int qre::complexity_graph::chain(unsigned int p,
+                                          const std::u32string &pump) const
+{
+  // nodes reached from 'p' by repeating the pump, with their successors
+  std::map<unsigned int, std::vector<unsigned int>> next;
+  std::vector<unsigned int> todo = { p };
+  while(todo.size())
+    {
+      unsigned int n = todo.back();
+      todo.pop_back();
+      if(next.count(n))
+        continue;
+      std::vector<bool> nodes(edges.size(), false);
+      nodes[n] = true;
+      for(char32_t ch : pump)
+        read(nodes, ch);
+      auto &targets = next[n];
+      for(unsigned int m = 0; m < edges.size(); m++)
+        if(nodes[m])
+          {
+            targets.push_back(m);
+            todo.push_back(m);
+          }
+    }
+
+  // components are numbered in reverse topological order, so the chains
+  // from the later ones are known first
+  std::vector<unsigned int> order;
+  for(auto &n : next)
+    order.push_back(n.first);
+  std::sort(order.begin(), order.end(), [this] (unsigned int a, unsigned int b)
+            { return scc[a] < scc[b]; });
+  std::map<unsigned int, unsigned int> length;
+  for(auto n : order)
+    {
+      // nodes reached by one or more repetitions
+      std::set<unsigned int> reached(next[n].begin(), next[n].end());
+      std::vector<unsigned int> stack(reached.begin(), reached.end());
+      while(stack.size())
+        {
+          unsigned int m = stack.back();
+          stack.pop_back();
+          for(auto t : next[m])
+            if(reached.insert(t).second)
+              stack.push_back(t);
+        }
+      unsigned int longest = 0;
+      for(auto m : reached)
+        if(scc[m] < scc[n])
+          longest = std::max(longest, length[m]);
+      length[n] = longest + reached.count(n);
+    }
+  return length[p];
+}
+
+bool qre::complexity_graph::attack(unsigned int node, const std::u32string &pump,
+                                   std::u32string &prefix, std::u32string &suffix) const
+{
+  if(!path(start, node, prefix) && (search == ~0u || !path(search, node, prefix)))
+    return false;
+
+  // without fix_right the backtracker stops at the first accepting node
+  std::vector<bool> nodes(edges.size(), false);
+  nodes[start] = true;
+  if(search != ~0u)
+    nodes[search] = true;
+  bool matched = false;
+  auto consume = [&] (std::vector<bool> &nodes, const std::u32string &word)
+    {
+      for(char32_t ch : word)
+        {
+          matched = matched || (!fix_right && accepts(nodes, false, ch));
+          read(nodes, ch);
+        }
+    };
+  consume(nodes, prefix);
+
+  // the nodes after each repetition of the pump become periodic
+  const unsigned int max_pumps = 64;
+  std::vector<std::vector<bool>> seen;
+  while(!matched && std::find(seen.begin(), seen.end(), nodes) == seen.end())
+    {
+      if(seen.size() == max_pumps)
+        return false;
+      seen.push_back(nodes);
+      consume(nodes, pump);
+    }
+  if(matched)
+    return false;
+  // repetitions before the period belong to the prefix
+  auto period = std::find(seen.begin(), seen.end(), nodes);
+  for(auto it = seen.begin(); it != period; it++)
+    prefix += pump;
+  seen.erase(seen.begin(), period);
+
+  // suffixes: a character no edge accepts, one the nodes reached do not
+  // accept, or none
+  std::vector<std::u32string> suffixes;
+  charset_t used;
+  for(auto &node_edges : edges)
+    for(auto &e : node_edges)
+      used = charset_union(used, e.set);
+  if(charset_invert(used).size())
+    suffixes.push_back(std::u32string(1, pick(charset_invert(used))));
+  for(unsigned int n = 0; n < edges.size(); n++)
+    if(seen.front()[n])
+      {
+        used.clear();
+        for(auto &e : edges[n])
+          used = charset_union(used, e.set);
+        if(charset_invert(used).size())
+          suffixes.push_back(std::u32string(1, pick(charset_invert(used))));
+      }
+  suffixes.push_back(U"");
+
+  for(auto &candidate : suffixes)
+    {
+      for(auto &period : seen)
+        {
+          nodes = period;
+          consume(nodes, candidate);
+          matched = matched || accepts(nodes, true);
+        }
+      if(!matched)
+        {
+          suffix = candidate;
+          return true;
+        }
+      matched = false;
+    }
+  return false;
+}
+
+qre::complexity_t qre::complexity(match_flag flags) const
+{
+  complexity_t result;
+
+  // counted repetitions with large bounds become loops
+  bool loops = false;
+  tokens_t tokens;
+  if(source.size())
+    tokens = tokeniser(utf8toutf32(source), icase);
+  for(auto &sym : tokens.syms)
+    if(sym.type == symbol::type_t::range && !sym.range.infinite
+       && sym.range.end >= loop_bound)
+      {
+        sym.range.begin = std::min<uint32_t>(sym.range.begin, 1);
+        sym.range.infinite = true;
+        loops = true;
+      }
+  if(loops)
+    {
+      qre relaxed;
+      relaxed.the_chain = relaxed.parse(tokens);
+      relaxed.compile();
+      result = relaxed.analyse(flags);
+    }
+  else
+    result = analyse(flags);
+
+  // engines that run in linear time, as chosen for long inputs
+  engine_type engine = select(flags, no_end);
+  result.backtracking = engine == engine_type::backtrack
+    || engine == engine_type::automaton_backtrack;
+  return result;
+}
+
+qre::complexity_t qre::analyse(match_flag flags) const
+{
+  complexity_t result;
+
+  bool fix_left = (flags & match_flag::fix_left) != match_flag::none;
+  bool fix_right = (flags & match_flag::fix_right) != match_flag::none;
+  bool multiline = (flags & match_flag::multiline) != match_flag::none;
+
+  // nodes: entered by consuming transitions, the start and in search mode
+  // the start looping on any character
+  complexity_graph g;
+  std::vector<unsigned int> node(states.size(), ~0u);
+  std::vector<const state_t*> entries;
+  auto enter = [&] (const state_t *state) -> unsigned int
+    {
+      if(node[state->id] == ~0u)
+        {
+          node[state->id] = entries.size();
+          entries.push_back(state);
+        }
+      return node[state->id];
+    };
+  unsigned int begin = enter(&states[the_chain.begin]);
+  for(auto &state : states)
+    for(auto &t : state.transitions)
+      if(t.test.type != test_t::test_type::epsilon
+         && t.test.type != test_t::test_type::bol
+         && t.test.type != test_t::test_type::eol)
+        enter(&states[t.state]);
+
+  // edges and acceptance of a node; outside multiline mode the beginning of
+  // the string can only be passed at the start
+  std::vector<uint8_t> paths(states.size(), 0);
+  auto closure = [&] (const state_t *entry, bool at_start,
+                      std::vector<complexity_graph::edge_t> &edges,
+                      bool &inside) -> bool
+    {
+      // count paths of zero-width transitions, up to two
+      std::fill(paths.begin(), paths.end(), 0);
+      std::stack<std::pair<const state_t*, uint8_t>> todo;
+      todo.push({ entry, 1 });
+      while(todo.size())
+        {
+          const state_t *state = todo.top().first;
+          uint8_t count = std::min(2, paths[state->id] + todo.top().second);
+          todo.pop();
+          if(count == paths[state->id])
+            continue;
+          uint8_t added = count - paths[state->id];
+          paths[state->id] = count;
+          for(auto &t : state->transitions)
+            if(t.test.type == test_t::test_type::epsilon
+               || t.test.type == test_t::test_type::eol
+               || (t.test.type == test_t::test_type::bol && (multiline || at_start)))
+              todo.push({ &states[t.state], added });
+        }
+
+      // the end reached without end of line tests
+      std::vector<bool> visited(states.size(), false);
+      std::stack<const state_t*> path;
+      path.push(entry);
+      visited[entry->id] = true;
+      inside = false;
+      while(path.size())
+        {
+          const state_t *state = path.top();
+          path.pop();
+          inside = inside || state == &states[the_chain.end];
+          for(auto &t : state->transitions)
+            if((t.test.type == test_t::test_type::epsilon
+                || (t.test.type == test_t::test_type::bol && (multiline || at_start)))
+               && !visited[t.state])
+              {
+                visited[t.state] = true;
+                path.push(&states[t.state]);
+              }
+        }
+
+      bool accepting = false;
+      for(unsigned int c = 0; c < states.size(); c++)
+        {
+          const state_t *state = &states[c];
+          if(!paths[state->id])
+            continue;
+          if(state == &states[the_chain.end])
+            accepting = true;
+          for(auto &t : state->transitions)
+            {
+              complexity_graph::edge_t edge;
+              edge.target = node[t.state];
+              edge.multiple = paths[state->id] > 1;
+              edge.atomic = state->nonstop;
+              switch(t.test.type)
+                {
+                case test_t::test_type::epsilon:
+                case test_t::test_type::bol:
+                case test_t::test_type::eol:
+                  continue;
+                case test_t::test_type::newline:
+                  if(t.test.neg)
+                    edge.set = charset(t.test, multiline);
+                  else
+                    edge.set = { { '\n', '\n' }, { '\r', '\r' } };
+                  break;
+                case test_t::test_type::backref:
+                  edge.set = { { 0, max_char } };
+                  break;
+                default:
+                  edge.set = charset(t.test, multiline);
+                  break;
+                }
+              if(edge.set.size())
+                edges.push_back(edge);
+            }
+        }
+      return accepting;
+    };
+
+  g.edges.resize(entries.size());
+  g.accepting.resize(entries.size());
+  g.accepting_inside.resize(entries.size());
+  for(unsigned int n = 0; n < entries.size(); n++)
+    {
+      bool inside;
+      g.accepting[n] = closure(entries[n], n == begin, g.edges[n], inside);
+      g.accepting_inside[n] = inside;
+    }
+  g.start = begin;
+  g.fix_right = fix_right;
+  g.multiline = multiline;
+
+  if(!fix_left)
+    {
+      // search: start again at the next character
+      unsigned int search = g.edges.size();
+      g.edges.emplace_back();
+      bool inside;
+      g.accepting.push_back(closure(entries[begin], false, g.edges.back(), inside));
+      g.accepting_inside.push_back(inside);
+      g.edges.back().push_back({ search, { { 0, max_char } }, false, false });
+      g.search = search;
+    }
+
+  // strongly connected components
+  std::vector<std::vector<unsigned int>> plain(g.edges.size());
+  for(unsigned int n = 0; n < g.edges.size(); n++)
+    for(auto &e : g.edges[n])
+      plain[n].push_back(e.target);
+  unsigned int count;
+  g.scc = complexity_graph::components(plain, count);
+  g.cyclic.assign(count, false);
+  for(unsigned int n = 0; n < g.edges.size(); n++)
+    for(auto &e : g.edges[n])
+      if(g.scc[e.target] == g.scc[n])
+        g.cyclic[g.scc[n]] = true;
+
+  auto report = [&] (complexity_type type, unsigned int target,
+                     const std::u32string &pump) -> bool
+    {
+      std::u32string prefix, suffix;
+      if(!g.attack(target, pump, prefix, suffix))
+        return false;
+      result.type = type;
+      result.prefix = utf32toutf8(prefix);
+      result.pump = utf32toutf8(pump);
+      result.suffix = utf32toutf8(suffix);
+      return true;
+    };
+  // ambiguity found without an input that is not matched
+  bool ambiguous = false;
+
+  // exponential
+  for(unsigned int c = 0; c < count; c++)
+    {
+      unsigned int n;
+      std::u32string pump;
+      if(g.cyclic[c] && g.ambiguous_cycle(c, n, pump))
+        {
+          if(report(complexity_type::exponential, n, pump))
+            {
+              result.degree = 0;
+              return result;
+            }
+          ambiguous = true;
+        }
+      if(!g.budget)
+        {
+          result.type = complexity_type::unknown;
+          return result;
+        }
+    }
+  if(ambiguous)
+    {
+      result.type = complexity_type::unknown;
+      return result;
+    }
+
+  // reachability between components, which are in reverse topological order
+  std::vector<std::vector<bool>> reaches(count, std::vector<bool>(count, false));
+  for(unsigned int c = 0; c < count; c++)
+    {
+      reaches[c][c] = true;
+      for(unsigned int n = 0; n < g.edges.size(); n++)
+        if(g.scc[n] == c)
+          for(auto &e : g.edges[n])
+            for(unsigned int d = 0; d < count; d++)
+              if(reaches[g.scc[e.target]][d])
+                reaches[c][d] = true;
+    }
+
+  // polynomial: longest chain on the pump of an ambiguous pair
+  std::vector<std::vector<unsigned int>> members(count);
+  for(unsigned int n = 0; n < g.edges.size(); n++)
+    members[g.scc[n]].push_back(n);
+  unsigned int longest = 1;
+  for(unsigned int c = 0; c < count; c++)
+    {
+      if(!g.cyclic[c])
+        continue;
+      for(unsigned int d = 0; d < c; d++)
+        {
+          if(!g.cyclic[d] || !reaches[c][d])
+            continue;
+          bool found = false;
+          for(auto p : members[c])
+            for(auto q : members[d])
+              {
+                std::u32string pump;
+                if(!found && g.ambiguous_pair(p, q, pump))
+                  {
+                    found = true;
+                    unsigned int length = g.chain(p, pump);
+                    if(length > longest)
+                      {
+                        if(report(complexity_type::polynomial, p, pump))
+                          longest = length;
+                        else
+                          ambiguous = true;
+                      }
+                  }
+                if(!g.budget)
+                  {
+                    result.type = complexity_type::unknown;
+                    return result;
+                  }
+              }
+        }
+    }
+
+  if(longest > 1)
+    result.degree = longest;
+  else if(ambiguous)
+    result.type = complexity_type::unknown;
+  return result;
+}
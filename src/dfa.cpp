@@ -0,0 +1,704 @@
+/*
+ * Copyright 2016 Nils Christopher Brause
+ *
+ * This file is part of libqre.
+ *
+ * libqre is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libqre is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libqre.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <qre.hpp>
+#include <algorithm>
+
+void qre::nfa_t::assign(const std::vector<std::vector<edge_t>> &nodes)
+{
+  edges.clear();
+  offsets.clear();
+  for(auto &n : nodes)
+    {
+      offsets.push_back(edges.size());
+      edges.insert(edges.end(), n.begin(), n.end());
+    }
+  offsets.push_back(edges.size());
+}
+
+std::vector<std::vector<qre::char_range>> qre::utf8_sequences(char_range range)
+{
+  // split the range until all characters in each part have the same length
+  // and the bytes of each part form independent ranges
+  std::vector<std::vector<char_range>> result;
+  std::vector<char_range> todo(1, range);
+  while(todo.size())
+    {
+      char_range r = todo.back();
+      todo.pop_back();
+
+      // surrogates do not occur in valid UTF-8
+      if(r.begin < 0xD800 && r.end > 0xDFFF)
+        {
+          todo.push_back({ 0xE000, r.end });
+          todo.push_back({ r.begin, 0xD7FF });
+          continue;
+        }
+      else if(r.begin >= 0xD800 && r.end <= 0xDFFF)
+        continue;
+      else if(r.begin >= 0xD800 && r.begin <= 0xDFFF)
+        r.begin = 0xE000;
+      else if(r.end >= 0xD800 && r.end <= 0xDFFF)
+        r.end = 0xD7FF;
+
+      // different lengths
+      bool split = false;
+      for(char32_t max : { 0x7F, 0x7FF, 0xFFFF })
+        if(r.begin <= max && r.end > max)
+          {
+            todo.push_back({ max+1, r.end });
+            todo.push_back({ r.begin, max });
+            split = true;
+            break;
+          }
+      if(split)
+        continue;
+
+      // continuation bytes must cover their full range
+      unsigned int length = r.end < 0x80 ? 1 : r.end < 0x800 ? 2
+        : r.end < 0x10000 ? 3 : 4;
+      for(unsigned int i = 1; i < length; i++)
+        {
+          char32_t mask = (1 << (6*i)) - 1;
+          if((r.begin & ~mask) != (r.end & ~mask))
+            {
+              if((r.begin & mask) != 0)
+                {
+                  todo.push_back({ (r.begin | mask) + 1, r.end });
+                  todo.push_back({ r.begin, r.begin | mask });
+                  split = true;
+                  break;
+                }
+              if((r.end & mask) != mask)
+                {
+                  todo.push_back({ r.end & ~mask, r.end });
+                  todo.push_back({ r.begin, (r.end & ~mask) - 1 });
+                  split = true;
+                  break;
+                }
+            }
+        }
+      if(split)
+        continue;
+
+      // encode both ends
+      std::vector<char_range> sequence(length);
+      char32_t begin = r.begin;
+      char32_t end = r.end;
+      for(unsigned int i = length; i-- > 1; )
+        {
+          sequence[i] = { 0x80 | (begin & 0x3F), 0x80 | (end & 0x3F) };
+          begin >>= 6;
+          end >>= 6;
+        }
+      const char32_t lead[] = { 0x00, 0x00, 0xC0, 0xE0, 0xF0 };
+      sequence[0] = { lead[length] | begin, lead[length] | end };
+      result.push_back(sequence);
+    }
+  return result;
+}
+
+void qre::nfa_compile()
+{
+  automaton = false;
+  capturing = false;
+  for(unsigned int multiline = 0; multiline < 2; multiline++)
+    for(unsigned int utf8 = 0; utf8 < 2; utf8++)
+      {
+        nfa[multiline][utf8] = nfa_t();
+        nfa_reverse[multiline][utf8] = nfa_t();
+        dfa_first[multiline][utf8].reset();
+        dfa_all[multiline][utf8].reset();
+        dfa_reverse[multiline][utf8].reset();
+      }
+
+  for(auto &state : states)
+    if(state.begin_capture)
+      capturing = true;
+
+  for(unsigned int multiline = 0; multiline < 2; multiline++)
+    {
+      // nodes of the Latin-1 and the UTF-8 automaton
+      std::vector<std::vector<nfa_t::edge_t>> nodes[2];
+      nodes[0].resize(states.size());
+      nodes[1].resize(states.size());
+      bool assertions = false;
+
+      // shared suffixes of UTF-8 sequences by first byte range and target
+      std::map<std::tuple<uint8_t, uint8_t, unsigned int>, unsigned int> suffixes;
+
+      for(auto &state : states)
+        {
+          // atomic groups depend on backtracking order
+          if(state.nonstop)
+            return;
+
+          for(auto &t : state.transitions)
+            {
+              nfa_t::edge_t edge;
+              edge.begin = edge.end = 0;
+              edge.target = t.state;
+              switch(t.test.type)
+                {
+                case test_t::test_type::epsilon:
+                  edge.type = nfa_t::edge_t::type_t::epsilon;
+                  nodes[0][state.id].push_back(edge);
+                  nodes[1][state.id].push_back(edge);
+                  break;
+
+                case test_t::test_type::bol:
+                  edge.type = multiline ? nfa_t::edge_t::type_t::bol_multiline
+                    : nfa_t::edge_t::type_t::bol;
+                  nodes[0][state.id].push_back(edge);
+                  nodes[1][state.id].push_back(edge);
+                  assertions = true;
+                  break;
+
+                case test_t::test_type::eol:
+                  edge.type = nfa_t::edge_t::type_t::eol;
+                  nodes[0][state.id].push_back(edge);
+                  nodes[1][state.id].push_back(edge);
+                  assertions = true;
+                  // end of line consumes the newline in multiline mode
+                  if(multiline)
+                    {
+                      edge.type = nfa_t::edge_t::type_t::range;
+                      edge.begin = edge.end = '\n';
+                      nodes[0][state.id].push_back(edge);
+                      nodes[1][state.id].push_back(edge);
+                    }
+                  break;
+
+                case test_t::test_type::newline:
+                  // "\R" may consume one or two characters
+                  if(!t.test.neg)
+                    return;
+                  // fall through
+                case test_t::test_type::any:
+                case test_t::test_type::character:
+                  edge.type = nfa_t::edge_t::type_t::range;
+                  for(auto &r : charset(t.test, multiline))
+                    {
+                      // characters are bytes
+                      if(r.begin <= 0xFF)
+                        {
+                          edge.begin = r.begin;
+                          edge.end = std::min<char32_t>(r.end, 0xFF);
+                          edge.target = t.state;
+                          nodes[0][state.id].push_back(edge);
+                        }
+
+                      // characters are sequences of byte ranges
+                      for(auto &sequence : utf8_sequences(r))
+                        {
+                          edge.target = t.state;
+                          for(unsigned int i = sequence.size()-1; i > 0; i--)
+                            {
+                              edge.begin = sequence[i].begin;
+                              edge.end = sequence[i].end;
+                              auto key = std::make_tuple(edge.begin, edge.end,
+                                                         edge.target);
+                              auto it = suffixes.find(key);
+                              if(it == suffixes.end())
+                                {
+                                  it = suffixes.insert({ key, nodes[1].size() }).first;
+                                  nodes[1].emplace_back(1, edge);
+                                }
+                              edge.target = it->second;
+                            }
+                          edge.begin = sequence[0].begin;
+                          edge.end = sequence[0].end;
+                          nodes[1][state.id].push_back(edge);
+                        }
+                    }
+                  break;
+
+                default:
+                  return; // backreferences
+                }
+            }
+        }
+
+      for(unsigned int utf8 = 0; utf8 < 2; utf8++)
+        {
+          nfa_t &a = nfa[multiline][utf8];
+          a.assign(nodes[utf8]);
+          a.start = the_chain.begin;
+          a.accept = the_chain.end;
+          a.assertions = assertions;
+
+          // reversed automaton
+          nfa_t &r = nfa_reverse[multiline][utf8];
+          std::vector<std::vector<nfa_t::edge_t>> reversed(nodes[utf8].size());
+          for(unsigned int n = 0; n < nodes[utf8].size(); n++)
+            for(auto &edge : nodes[utf8][n])
+              {
+                nfa_t::edge_t e = edge;
+                e.target = n;
+                reversed[edge.target].push_back(e);
+              }
+          r.assign(reversed);
+          r.start = a.accept;
+          r.accept = a.start;
+          r.assertions = a.assertions;
+        }
+    }
+
+  for(unsigned int multiline = 0; multiline < 2; multiline++)
+    for(unsigned int utf8 = 0; utf8 < 2; utf8++)
+      {
+        dfa_first[multiline][utf8] = std::make_shared<dfa_t>();
+        dfa_first[multiline][utf8]->nfa = &nfa[multiline][utf8];
+        dfa_first[multiline][utf8]->cut = true;
+        dfa_all[multiline][utf8] = std::make_shared<dfa_t>();
+        dfa_all[multiline][utf8]->nfa = &nfa[multiline][utf8];
+        dfa_reverse[multiline][utf8] = std::make_shared<dfa_t>();
+        dfa_reverse[multiline][utf8]->nfa = &nfa_reverse[multiline][utf8];
+      }
+
+  automaton = true;
+}
+
+void qre::dfa_attach(bool fresh)
+{
+  for(unsigned int multiline = 0; multiline < 2; multiline++)
+    for(unsigned int utf8 = 0; utf8 < 2; utf8++)
+      {
+        std::shared_ptr<dfa_t> *caches[3] = { &dfa_first[multiline][utf8],
+                                              &dfa_all[multiline][utf8],
+                                              &dfa_reverse[multiline][utf8] };
+        const nfa_t *nfas[3] = { &nfa[multiline][utf8], &nfa[multiline][utf8],
+                                 &nfa_reverse[multiline][utf8] };
+        for(unsigned int c = 0; c < 3; c++)
+          if(*caches[c])
+            {
+              if(fresh)
+                {
+                  std::shared_ptr<dfa_t> cache = std::make_shared<dfa_t>();
+                  cache->cut = (*caches[c])->cut;
+                  *caches[c] = cache;
+                }
+              (*caches[c])->nfa = nfas[c];
+            }
+      }
+}
+
+unsigned int qre::dfa_state(dfa_t &dfa, const std::vector<unsigned int> &kernel,
+                            uint8_t context)
+{
+  const nfa_t &nfa = *dfa.nfa;
+  if(!nfa.assertions)
+    context = 0;
+
+  // find kernel
+  unsigned int k;
+  auto it = dfa.kernel_index.find(kernel);
+  if(it != dfa.kernel_index.end())
+    k = it->second;
+  else
+    {
+      k = dfa.kernels.size();
+      dfa.kernels.push_back(dfa_t::kernel_t());
+      dfa.kernels.back().nodes = kernel;
+      for(auto &v : dfa.kernels.back().variants)
+        v = -1;
+      dfa.kernel_index[kernel] = k;
+    }
+
+  // find state
+  if(dfa.kernels[k].variants[context] >= 0)
+    return dfa.kernels[k].variants[context];
+
+  unsigned int s = dfa.states.size();
+  dfa.kernels[k].variants[context] = s;
+  dfa.states.push_back(dfa_t::dstate_t());
+  dfa_t::dstate_t &state = dfa.states.back();
+  state.kernel = k;
+  state.context = context;
+  dfa.next.resize(dfa.states.size() * 256, -1);
+
+  // epsilon closure in order of priority
+  const unsigned int seed = nfa.size(); // restart in unanchored mode
+  const unsigned int threads = nfa.size()+2; // consuming edges
+  std::vector<bool> visited(nfa.size()+2, false);
+  std::stack<unsigned int> todo;
+  for(auto it = kernel.rbegin(); it != kernel.rend(); it++)
+    todo.push(*it);
+
+  while(todo.size())
+    {
+      unsigned int n = todo.top();
+      todo.pop();
+
+      // consuming edge
+      if(n >= threads)
+        {
+          state.threads.push_back(n - threads);
+          continue;
+        }
+
+      if(visited[n])
+        continue;
+      visited[n] = true;
+
+      // keep restarting after all other threads
+      if(n == seed)
+        {
+          todo.push(seed+1);
+          todo.push(nfa.start);
+          continue;
+        }
+      else if(n == seed+1)
+        {
+          state.threads.push_back(nfa.edges.size());
+          continue;
+        }
+
+      if(n == nfa.accept)
+        {
+          state.accepting = true;
+          if(dfa.cut)
+            break;
+          continue;
+        }
+
+      for(unsigned int e = nfa.offsets[n+1]; e-- > nfa.offsets[n]; )
+        {
+          const nfa_t::edge_t &edge = nfa.edges[e];
+          switch(edge.type)
+            {
+            case nfa_t::edge_t::type_t::epsilon:
+              todo.push(edge.target);
+              break;
+            case nfa_t::edge_t::type_t::bol:
+              if(context & at_begin)
+                todo.push(edge.target);
+              break;
+            case nfa_t::edge_t::type_t::bol_multiline:
+              if((context & at_begin)
+                 || ((context & after_newline) && !(context & at_end)))
+                todo.push(edge.target);
+              break;
+            case nfa_t::edge_t::type_t::eol:
+              if(context & at_end)
+                todo.push(edge.target);
+              break;
+            case nfa_t::edge_t::type_t::range:
+              todo.push(threads + e);
+              break;
+            }
+        }
+    }
+
+  return s;
+}
+
+unsigned int qre::dfa_next(dfa_t &dfa, unsigned int s, uint8_t ch,
+                           uint8_t context)
+{
+  const nfa_t &nfa = *dfa.nfa;
+  if(!nfa.assertions)
+    context = 0;
+
+  // cached transition?
+  signed int k = -1;
+  signed int n = dfa.next[s*256 + ch];
+  if(n >= 0)
+    {
+      if(dfa.states[n].context == context)
+        return n;
+      k = dfa.states[n].kernel;
+      if(dfa.kernels[k].variants[context] >= 0)
+        return dfa.next[s*256 + ch] = dfa.kernels[k].variants[context];
+    }
+
+  // follow all threads
+  std::vector<unsigned int> kernel;
+  if(k >= 0)
+    kernel = dfa.kernels[k].nodes;
+  else
+    {
+      std::vector<bool> added(nfa.size(), false);
+      for(auto &e : dfa.states[s].threads)
+        if(e == nfa.edges.size())
+          kernel.push_back(nfa.size()); // restart
+        else
+          {
+            const nfa_t::edge_t &edge = nfa.edges[e];
+            if(edge.begin <= ch && ch <= edge.end && !added[edge.target])
+              {
+                added[edge.target] = true;
+                kernel.push_back(edge.target);
+              }
+          }
+    }
+
+  // limit memory usage
+  if(dfa.states.size() >= dfa_max_states)
+    {
+#ifdef DEBUG
+      std::cerr << "flushing DFA cache" << std::endl;
+#endif
+      dfa.kernels.clear();
+      dfa.kernel_index.clear();
+      dfa.states.clear();
+      dfa.next.clear();
+      dfa.starts.clear();
+      return dfa_state(dfa, kernel, context);
+    }
+
+  unsigned int result = dfa_state(dfa, kernel, context);
+  dfa.next[s*256 + ch] = result;
+  return result;
+}
+
+size_t qre::dfa_run(dfa_t &dfa, unsigned int s, const text &str,
+                    size_t pos, size_t limit, bool reverse)
+{
+  const nfa_t &nfa = *dfa.nfa;
+  dfa_t::dstate_t &state = dfa.states[s];
+
+  // bytes that lead back to the same kernel, in a context other bytes do not
+  // change: newlines do
+  if(state.run < 0)
+    {
+      state.run = 0;
+      if(nfa.assertions && state.context)
+        return 0;
+      const std::vector<unsigned int> &nodes = dfa.kernels[state.kernel].nodes;
+      std::vector<bool> stay(256, false);
+      std::vector<unsigned int> kernel;
+      std::vector<bool> added(nfa.size(), false);
+      for(unsigned int ch = 0; ch < 256; ch++)
+        {
+          if(nfa.assertions && ch == '\n')
+            continue;
+          kernel.clear();
+          for(auto &e : state.threads)
+            if(e == nfa.edges.size())
+              kernel.push_back(nfa.size()); // restart
+            else
+              {
+                const nfa_t::edge_t &edge = nfa.edges[e];
+                if(edge.begin <= ch && ch <= edge.end && !added[edge.target])
+                  {
+                    added[edge.target] = true;
+                    kernel.push_back(edge.target);
+                  }
+              }
+          for(auto &n : kernel)
+            if(n < nfa.size())
+              added[n] = false;
+          if(kernel == nodes)
+            {
+              stay[ch] = true;
+              state.run = 1;
+            }
+        }
+      if(state.run)
+        state.run_class = byte_class(stay);
+    }
+  if(!state.run)
+    return 0;
+
+  // within the segment around 'pos'
+  str[reverse ? pos-1 : pos];
+  const uint8_t *window = reinterpret_cast<const uint8_t*>(str.window);
+  if(reverse)
+    {
+      size_t n = pos - std::max(limit, str.window_begin);
+      return class_run_reverse(state.run_class, window + (pos - n - str.window_begin), n);
+    }
+  size_t n = std::min(limit, str.window_begin + str.window_length) - pos;
+  return class_run(state.run_class, window + (pos - str.window_begin), n);
+}
+
+uint8_t qre::dfa_context_at(const text &str, size_t pos)
+{
+  uint8_t context = 0;
+  if(pos == 0)
+    context |= at_begin;
+  else if(str[pos-1] == '\n')
+    context |= after_newline;
+  if(pos == str.length())
+    context |= at_end;
+  return context;
+}
+
+unsigned int qre::dfa_start(dfa_t &dfa, bool anchored, uint8_t context)
+{
+  // kept apart from the kernel index, so that no kernel is built per scan
+  if(dfa.starts.empty())
+    dfa.starts.assign(16, -1);
+  signed int &start = dfa.starts[anchored * 8 + context];
+  if(start < 0)
+    {
+      const unsigned int seed = dfa.nfa->size();
+      start = dfa_state(dfa, { anchored ? dfa.nfa->start : seed }, context);
+    }
+  return start;
+}
+
+bool qre::dfa_scan(dfa_t &dfa, const text &str, size_t begin,
+                   bool anchored, bool fix_right, size_t &end)
+{
+  const bool assertions = dfa.nfa->assertions;
+  size_t pos = begin;
+  unsigned int s = dfa_start(dfa, anchored, dfa_context_at(str, pos));
+  bool found = false;
+  unsigned int loops = 0; // transitions from s to itself in a row
+
+  while(true)
+    {
+      if(dfa.states[s].accepting && (!fix_right || pos == str.length()))
+        {
+          found = true;
+          end = pos;
+        }
+      if(pos == str.length() || dfa.states[s].threads.empty())
+        break;
+
+      // cached transitions are followed inline
+      uint8_t ch = str[pos++];
+      uint8_t context = assertions ? dfa_context_at(str, pos) : 0;
+      signed int n = dfa.next[s*256 + ch];
+      if(n == static_cast<signed int>(s) && dfa.states[n].context == context)
+        {
+          // the rest of a longer run at once, the last byte may change the
+          // context
+          if(++loops >= dfa_run_after && pos < str.length() && dfa.states[s].run)
+            {
+              pos += dfa_run(dfa, s, str, pos, str.length() - assertions, false);
+              loops = 0;
+            }
+          continue;
+        }
+      loops = 0;
+      if(n >= 0 && dfa.states[n].context == context)
+        s = n;
+      else
+        s = dfa_next(dfa, s, ch, context);
+    }
+
+  return found;
+}
+
+bool qre::dfa_scan_reverse(dfa_t &dfa, const text &str,
+                           size_t start, size_t end,
+                           bool anchored, size_t &begin)
+{
+  const bool assertions = dfa.nfa->assertions;
+  size_t pos = end;
+  unsigned int s = dfa_start(dfa, true, dfa_context_at(str, pos));
+  bool found = false;
+  unsigned int loops = 0; // transitions from s to itself in a row
+
+  while(true)
+    {
+      if(dfa.states[s].accepting && (!anchored || pos == start))
+        {
+          found = true;
+          begin = pos;
+        }
+      if(pos == start || dfa.states[s].threads.empty())
+        break;
+
+      // cached transitions are followed inline
+      uint8_t ch = str[--pos];
+      uint8_t context = assertions ? dfa_context_at(str, pos) : 0;
+      signed int n = dfa.next[s*256 + ch];
+      if(n == static_cast<signed int>(s) && dfa.states[n].context == context)
+        {
+          // the rest of a longer run at once, but the context depends on the
+          // byte before the last one
+          if(++loops >= dfa_run_after && pos > start && dfa.states[s].run)
+            {
+              size_t run = dfa_run(dfa, s, str, pos, start, true);
+              pos -= assertions && run ? run - 1 : run;
+              loops = 0;
+            }
+          continue;
+        }
+      loops = 0;
+      if(n >= 0 && dfa.states[n].context == context)
+        s = n;
+      else
+        s = dfa_next(dfa, s, ch, context);
+    }
+
+  return found;
+}
+
+template <typename function>
+bool qre::dfa_use(const std::shared_ptr<dfa_t> &dfa, match_stats *stats,
+                  function scan)
+{
+  // concurrent matches with the same pattern use a temporary cache
+  std::unique_lock<std::mutex> lock(dfa->mutex, std::try_to_lock);
+  dfa_t tmp;
+  dfa_t &cache = lock.owns_lock() ? *dfa : tmp;
+  if(!lock.owns_lock())
+    {
+      tmp.nfa = dfa->nfa;
+      tmp.cut = dfa->cut;
+    }
+  if(!stats)
+    return scan(cache);
+
+  unsigned int before = cache.states.size();
+  bool result = scan(cache);
+  // the cache may have been flushed in between
+  unsigned int states = cache.states.size();
+  if(states >= before)
+    states -= before;
+  stats->dfa_states += states;
+  stats->bytes_allocated += states * (sizeof(dfa_t::dstate_t)
+                                      + 256 * sizeof(signed int));
+  return result;
+}
+
+bool qre::automaton_match(const text &str, bool fix_left,
+                          bool fix_right, bool longest, bool multiline,
+                          bool utf8, size_t start, match_stats *stats,
+                          size_t &begin, size_t &end) const
+{
+  // end of the leftmost match
+  end = 0;
+  if(!dfa_use(fix_right ? dfa_all[multiline][utf8] : dfa_first[multiline][utf8], stats,
+              [&] (dfa_t &dfa) -> bool
+              { return dfa_scan(dfa, str, start, fix_left, fix_right, end); }))
+    return false;
+
+  // beginning of the leftmost match
+  begin = start;
+  if(!fix_left)
+    dfa_use(dfa_reverse[multiline][utf8], stats,
+            [&] (dfa_t &dfa) -> bool
+            { return dfa_scan_reverse(dfa, str, start, end, false, begin); });
+
+  // longest match from there
+  if(longest && !fix_right)
+    dfa_use(dfa_all[multiline][utf8], stats,
+            [&] (dfa_t &dfa) -> bool
+            { return dfa_scan(dfa, str, begin, true, false, end); });
+
+  return true;
+}
@@ -0,0 +1,184 @@
+/*
+ * Copyright 2016 Nils Christopher Brause
+ *
+ * This file is part of libqre.
+ *
+ * libqre is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libqre is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libqre.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <deque>
+#include <qre.hpp>
+
+void qre::engine_compile()
+{
+  // bytes every match consumes at least
+  min_length = 0;
+  backreferences = false;
+  capture_groups.clear();
+  if(states.empty())
+    return;
+  // repetitions enter the same group in several states
+  std::set<std::pair<signed int, std::string>> groups;
+  for(auto &state : states)
+    {
+      for(auto &t : state.transitions)
+        if(t.test.type == test_t::test_type::backref)
+          backreferences = true;
+      if(!state.begin_capture)
+        continue;
+      const capture_t &c = state.captures.back();
+      if(groups.insert({ c.named ? 0 : c.number, c.name }).second)
+        capture_groups.push_back(c);
+    }
+  std::vector<unsigned int> distance(states.size(), infinite_length);
+  std::deque<unsigned int> todo;
+  distance[the_chain.begin] = 0;
+  todo.push_back(the_chain.begin);
+  while(todo.size())
+    {
+      unsigned int v = todo.front();
+      todo.pop_front();
+      if(v == the_chain.end)
+        {
+          min_length = distance[v];
+          break;
+        }
+      for(auto &t : states[v].transitions)
+        {
+          unsigned int w = t.state;
+          bool consuming = t.test.type == test_t::test_type::any
+            || t.test.type == test_t::test_type::newline
+            || t.test.type == test_t::test_type::character;
+          if(distance[v] + consuming >= distance[w])
+            continue;
+          distance[w] = distance[v] + consuming;
+          if(consuming)
+            todo.push_back(w);
+          else
+            todo.push_front(w);
+        }
+    }
+
+  // patterns that consist of their literal prefix only
+  for(unsigned int utf8 = 0; utf8 < 2; utf8++)
+    {
+      literal[utf8] = false;
+      const state_t *state = &states[the_chain.begin];
+      unsigned int length = 0;
+      while(state != &states[the_chain.end] && state->transitions.size() == 1
+            && !state->begin_capture && state->captures.empty())
+        {
+          const transition_t &t = state->transitions.front();
+          if(t.test.type == test_t::test_type::character)
+            length++;
+          else if(t.test.type != test_t::test_type::epsilon)
+            break;
+          state = &states[t.state];
+        }
+      literal[utf8] = state == &states[the_chain.end] && length > 0
+        && length == prefix[utf8].length();
+    }
+}
+
+void qre::use_engine(engine_type engine)
+{
+  forced = engine;
+}
+
+qre::engine_type qre::select(match_flag flags, size_t length,
+                             bool captures) const
+{
+  bool partial = (flags & match_flag::partial) != match_flag::none;
+  bool fix_left = (flags & match_flag::fix_left) != match_flag::none;
+  bool fix_right = (flags & match_flag::fix_right) != match_flag::none;
+  bool multiline = (flags & match_flag::multiline) != match_flag::none;
+  bool utf8 = (flags & match_flag::utf8) != match_flag::none;
+  bool longest = (flags & match_flag::longest) != match_flag::none;
+
+  bool can_onepass = fix_left && fix_right && !partial && onepass.size()
+    && !(multiline && onepass_eol);
+
+  if(forced != engine_type::none)
+    {
+      bool possible = true;
+      switch(forced)
+        {
+        case engine_type::literal:
+          possible = literal[utf8] && !partial;
+          break;
+        case engine_type::onepass:
+          possible = can_onepass;
+          break;
+        case engine_type::automaton:
+          possible = automaton && !partial && !(capturing && captures);
+          break;
+        case engine_type::automaton_backtrack:
+          possible = automaton && !partial;
+          break;
+        default:
+          break;
+        }
+      if(!possible)
+        throw std::runtime_error("Engine cannot match this pattern with these flags.");
+      return forced;
+    }
+
+  // input too short for any match
+  if(!partial && length < min_length)
+    return engine_type::none;
+
+  if(literal[utf8] && !partial)
+    return engine_type::literal;
+
+  // without captures only the bounds of the match are needed
+  if(automaton && !partial && !captures)
+    return engine_type::automaton;
+
+  // anchored full matches of one-pass patterns need no backtracking
+  if(can_onepass)
+    return engine_type::onepass;
+
+  if(automaton && !partial)
+    {
+      if(!capturing)
+        return engine_type::automaton;
+
+      // the longest match is the first path reaching its end, and on longer
+      // inputs the backtracker should not try every start position
+      if(longest || length >= automaton_threshold)
+        return engine_type::automaton_backtrack;
+    }
+
+  return engine_type::backtrack;
+}
+
+bool qre::literal_match(const text &str, bool fix_left, bool fix_right,
+                        bool utf8, size_t start, size_t &pos) const
+{
+  const std::string &literal = prefix[utf8];
+  const std::string &mask = prefix_mask[utf8];
+  const size_t n = literal.length();
+
+  // the prefilter already found the first occurrence in search mode
+  pos = start;
+  if(fix_right && !fix_left)
+    pos = str.length() >= start + n ? str.length() - n : start;
+
+  bool found = pos + n <= str.length() && (!fix_right || pos + n == str.length());
+  for(size_t c = 0; found && c < n; c++)
+    found = static_cast<char>(str[pos+c] | mask[c]) == literal[c];
+  return found;
+}
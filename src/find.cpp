@@ -0,0 +1,69 @@
+/*
+ * Copyright 2016 Nils Christopher Brause
+ *
+ * This file is part of libqre.
+ *
+ * libqre is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libqre is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libqre.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <qre.hpp>
+
+bool qre::test(const text &str, match_flag flags) const
+{
+  size_t begin, end;
+  return find(str, input_flags(str, flags), 0, begin, end);
+}
+
+qre::span_t qre::find_pos(const text &str, match_flag flags) const
+{
+  span_t result;
+  size_t begin, end;
+  if(find(str, input_flags(str, flags), 0, begin, end))
+    {
+      result.found = true;
+      result.pos = begin;
+      result.length = end - begin;
+    }
+  return result;
+}
+
+size_t qre::count(const text &str, match_flag flags) const
+{
+  flags = input_flags(str, flags);
+  bool fix_left = (flags & match_flag::fix_left) != match_flag::none;
+  bool utf8 = (flags & match_flag::utf8) != match_flag::none;
+
+  size_t result = 0;
+  size_t pos = 0;
+  size_t begin, end;
+  while(find(str, flags, pos, begin, end))
+    {
+      result++;
+      if(fix_left)
+        break; // later searches would be anchored at the previous match
+      pos = end;
+      if(end == begin)
+        {
+          // an empty match would be found again
+          if(end == str.length())
+            break;
+          if(utf8)
+            advance(str, pos);
+          else
+            pos++;
+        }
+    }
+  return result;
+}
@@ -19,65 +19,64 @@
  */
 
 #include <qre.hpp>
+#include <unordered_map>
 
-void qre::epsilon(std::shared_ptr<state_t> a, std::shared_ptr<state_t> b) const
+unsigned int qre::new_state()
+{
+  states.emplace_back();
+  return states.size()-1;
+}
+
+void qre::epsilon(unsigned int a, unsigned int b)
 {
   transition_t t;
   t.test.type = test_t::test_type::epsilon;
   t.state = b;
-  a->transitions.push_back(t);
-  b->prev.push_back(a);
-  a->nonstop = nonstop;
+  states[a].transitions.push_back(t);
+  states[a].nonstop = nonstop;
 }
 
-void qre::merge_state(std::shared_ptr<state_t> &dst,
-                      std::shared_ptr<state_t> &src) const
+void qre::merge_state(unsigned int dst, unsigned int src)
 {
-  assert(src->prev.size() == 0);
-  dst->transitions.insert(dst->transitions.end(),
-                          src->transitions.begin(),
-                          src->transitions.end());
-  for(auto &t : dst->transitions)
-    for(auto &p : t.state->prev)
-      if(p.lock() == src)
-        p = dst;
-  dst->begin_capture |= src->begin_capture;
-  dst->nonstop |= src->nonstop;
-  dst->captures.insert(dst->captures.end(), src->captures.begin(), src->captures.end());
+  state_t &d = states[dst];
+  state_t &s = states[src];
+  d.transitions.insert(d.transitions.end(),
+                       s.transitions.begin(),
+                       s.transitions.end());
+  d.begin_capture |= s.begin_capture;
+  d.nonstop |= s.nonstop;
+  d.captures.insert(d.captures.end(), s.captures.begin(), s.captures.end());
 }
 
 qre::chain_t qre::clone(chain_t chain)
 {
-  std::map<std::shared_ptr<state_t>, std::shared_ptr<state_t>> state_map;
-
-  std::function<std::shared_ptr<state_t>(std::shared_ptr<state_t>)> clone
-    = [&clone, &state_map] (std::shared_ptr<state_t> state) -> std::shared_ptr<state_t>
+  // copy all states reachable from the beginning of the chain
+  std::unordered_map<unsigned int, unsigned int> state_map;
+  std::vector<unsigned int> todo;
+  state_map[chain.begin] = new_state();
+  todo.push_back(chain.begin);
+  while(todo.size())
     {
-      // state already cloned?
-      auto it = state_map.find(state);
-      if(it != state_map.end())
-        return it->second;
-
-      // clone state
-      std::shared_ptr<state_t> newstate = std::make_shared<state_t>();
-      state_map[state] = newstate;
-      newstate->begin_capture = state->begin_capture;
-      newstate->captures = state->captures;
-      newstate->nonstop = state->nonstop;
-      for(auto &t : state->transitions)
+      unsigned int state = todo.back();
+      todo.pop_back();
+      // new states may move the arena
+      for(unsigned int c = 0; c < states[state].transitions.size(); c++)
         {
-          transition_t t2;
-          t2.test = t.test;
-          t2.state = clone(t.state);
-          newstate->transitions.push_back(t2);
-          t2.state->prev.push_back(newstate);
+          unsigned int target = states[state].transitions[c].state;
+          if(state_map.count(target))
+            continue;
+          unsigned int newtarget = new_state();
+          state_map[target] = newtarget;
+          todo.push_back(target);
         }
-
-      return newstate;
-    };
+      unsigned int newstate = state_map[state];
+      states[newstate] = states[state];
+      for(auto &t : states[newstate].transitions)
+        t.state = state_map[t.state];
+    }
 
   chain_t result;
-  result.begin = clone(chain.begin);
+  result.begin = state_map.at(chain.begin);
   result.end = state_map.at(chain.end);
   return result;
 }
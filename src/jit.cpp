@@ -0,0 +1,390 @@
+/*
+ * Copyright 2016 Nils Christopher Brause
+ *
+ * This file is part of libqre.
+ *
+ * libqre is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libqre is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libqre.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#if defined(__GNUC__) && defined(__x86_64__) && defined(__linux__)
+#define QRE_JIT
+#include <sys/mman.h>
+#endif
+
+#include <cstring>
+#include <initializer_list>
+#include <qre.hpp>
+
+struct qre::jit_code_t
+{
+  void *pages = nullptr;
+  size_t size = 0;
+
+  ~jit_code_t()
+  {
+#ifdef QRE_JIT
+    if(pages)
+      munmap(pages, size);
+#endif
+  }
+};
+
+#ifdef QRE_JIT
+namespace
+{
+  // Emits x86-64 code with 32 bit jumps to labels that are resolved at the
+  // end. Registers of the generated functions:
+  //   rdi  input data       rsi  input length     rdx  position
+  //   rcx  stack base       r8   stack end        r9   stack top
+  //   rax  new position     r10  scratch
+  struct assembler
+  {
+    std::vector<uint8_t> code;
+    std::vector<size_t> labels; // offset per label
+    std::vector<std::pair<size_t, unsigned int>> fixups; // rel32 and label
+
+    enum condition : uint8_t
+    { jb = 0x82, jae = 0x83, je = 0x84, jne = 0x85, jbe = 0x86 };
+
+    unsigned int label()
+    {
+      labels.push_back(~static_cast<size_t>(0));
+      return labels.size()-1;
+    }
+    void bind(unsigned int l) { labels[l] = code.size(); }
+
+    void emit(std::initializer_list<uint8_t> bytes)
+    {
+      code.insert(code.end(), bytes);
+    }
+    void imm32(uint32_t value)
+    {
+      for(unsigned int c = 0; c < 4; c++)
+        code.push_back(value >> (8*c));
+    }
+    // displacement from the end of the instruction, which it ends
+    void rel32(unsigned int l)
+    {
+      fixups.push_back({ code.size(), l });
+      imm32(0);
+    }
+
+    void jmp(unsigned int l) { emit({ 0xE9 }); rel32(l); }
+    void jcc(condition cc, unsigned int l) { emit({ 0x0F, cc }); rel32(l); }
+
+    void resolve()
+    {
+      for(auto &f : fixups)
+        {
+          int32_t rel = labels[f.second] - (f.first + 4);
+          std::memcpy(&code[f.first], &rel, 4);
+        }
+    }
+  };
+}
+#endif
+
+void qre::jit_compile()
+{
+  jit_code.reset();
+  for(auto &modes : jit_entry)
+    modes[0] = modes[1] = nullptr;
+#ifdef QRE_JIT_DEFAULT
+  jit = true;
+#endif
+#ifdef QRE_JIT
+  if(!jit || states.empty())
+    return;
+
+  assembler a;
+
+  for(auto &state : states)
+    for(auto &t : state.transitions)
+      if(t.test.type == test_t::test_type::backref)
+        return;
+
+  // bitmaps of larger sets follow the code
+  std::map<std::vector<uint8_t>, unsigned int> bitmaps;
+
+  size_t entries[2][2];
+  for(unsigned int multiline = 0; multiline < 2; multiline++)
+    for(unsigned int fix_right = 0; fix_right < 2; fix_right++)
+      {
+        entries[multiline][fix_right] = a.code.size();
+        unsigned int fail = a.label();
+        unsigned int nomatch = a.label();
+        unsigned int overflow = a.label();
+        std::vector<unsigned int> state_labels;
+        for(unsigned int c = 0; c < states.size(); c++)
+          state_labels.push_back(a.label());
+
+        a.emit({ 0x49, 0x89, 0xC9 }); // mov r9, rcx
+        a.jmp(state_labels[the_chain.begin]);
+
+        // back to the position and transition of the last frame
+        a.bind(fail);
+        a.emit({ 0x49, 0x39, 0xC9 }); // cmp r9, rcx
+        a.jcc(assembler::je, nomatch);
+        a.emit({ 0x49, 0x83, 0xE9, 0x10 }); // sub r9, 16
+        a.emit({ 0x49, 0x8B, 0x51, 0x08 }); // mov rdx, [r9+8]
+        a.emit({ 0x41, 0xFF, 0x21 }); // jmp [r9]
+        a.bind(nomatch);
+        a.emit({ 0x48, 0xC7, 0xC0 }); // mov rax, jit_no_match
+        a.imm32(static_cast<uint32_t>(jit_no_match));
+        a.emit({ 0xC3 }); // ret
+        a.bind(overflow);
+        a.emit({ 0x48, 0xC7, 0xC0 }); // mov rax, jit_overflow
+        a.imm32(static_cast<uint32_t>(jit_overflow));
+        a.emit({ 0xC3 }); // ret
+
+        for(auto &state : states)
+          {
+            a.bind(state_labels[state.id]);
+            if(state.id == the_chain.end)
+              {
+                if(fix_right)
+                  {
+                    a.emit({ 0x48, 0x39, 0xF2 }); // cmp rdx, rsi
+                    a.jcc(assembler::jne, fail);
+                  }
+                a.emit({ 0x48, 0x89, 0xD0 }); // mov rax, rdx
+                a.emit({ 0xC3 }); // ret
+                continue;
+              }
+
+            std::vector<unsigned int> next;
+            for(unsigned int c = 1; c < state.transitions.size(); c++)
+              next.push_back(a.label());
+            next.push_back(fail);
+
+            for(unsigned int c = 0; c < state.transitions.size(); c++)
+              {
+                if(c > 0)
+                  a.bind(next[c-1]);
+                const test_t &test = state.transitions[c].test;
+                unsigned int ok = a.label();
+
+                // new position in rax or on to the next transition
+                switch(test.type)
+                  {
+                  case test_t::test_type::epsilon:
+                    a.emit({ 0x48, 0x89, 0xD0 }); // mov rax, rdx
+                    break;
+
+                  case test_t::test_type::bol:
+                    a.emit({ 0x48, 0x85, 0xD2 }); // test rdx, rdx
+                    if(multiline)
+                      {
+                        a.jcc(assembler::je, ok);
+                        a.emit({ 0x48, 0x39, 0xF2 }); // cmp rdx, rsi
+                        a.jcc(assembler::jae, next[c]);
+                        a.emit({ 0x80, 0x7C, 0x17, 0xFF, '\n' }); // cmp byte [rdi+rdx-1], '\n'
+                      }
+                    a.jcc(assembler::jne, next[c]);
+                    a.bind(ok);
+                    a.emit({ 0x48, 0x89, 0xD0 }); // mov rax, rdx
+                    break;
+
+                  case test_t::test_type::eol:
+                    a.emit({ 0x48, 0x89, 0xD0 }); // mov rax, rdx
+                    a.emit({ 0x48, 0x39, 0xF2 }); // cmp rdx, rsi
+                    if(multiline)
+                      {
+                        // a newline is consumed
+                        a.jcc(assembler::je, ok);
+                        a.emit({ 0x80, 0x3C, 0x17, '\n' }); // cmp byte [rdi+rdx], '\n'
+                        a.jcc(assembler::jne, next[c]);
+                        a.emit({ 0x48, 0x8D, 0x42, 0x01 }); // lea rax, [rdx+1]
+                      }
+                    else
+                      a.jcc(assembler::jne, next[c]);
+                    a.bind(ok);
+                    break;
+
+                  case test_t::test_type::newline:
+                    if(!test.neg)
+                      {
+                        // CR, LF or CRLF
+                        a.emit({ 0x48, 0x39, 0xF2 }); // cmp rdx, rsi
+                        a.jcc(assembler::jae, next[c]);
+                        a.emit({ 0x48, 0x8D, 0x42, 0x01 }); // lea rax, [rdx+1]
+                        a.emit({ 0x80, 0x3C, 0x17, '\n' }); // cmp byte [rdi+rdx], '\n'
+                        a.jcc(assembler::je, ok);
+                        a.emit({ 0x80, 0x3C, 0x17, '\r' }); // cmp byte [rdi+rdx], '\r'
+                        a.jcc(assembler::jne, next[c]);
+                        a.emit({ 0x48, 0x39, 0xF0 }); // cmp rax, rsi
+                        a.jcc(assembler::jae, ok);
+                        a.emit({ 0x80, 0x7C, 0x17, 0x01, '\n' }); // cmp byte [rdi+rdx+1], '\n'
+                        a.jcc(assembler::jne, ok);
+                        a.emit({ 0x48, 0x8D, 0x42, 0x02 }); // lea rax, [rdx+2]
+                        a.bind(ok);
+                        break;
+                      }
+                    // fall through, "\N" is a single character test
+
+                  case test_t::test_type::any:
+                  case test_t::test_type::character:
+                    {
+                      // bytes the test consumes
+                      charset_t set;
+                      try
+                        {
+                          for(auto &r : charset(test, multiline))
+                            if(r.begin <= 0xFF)
+                              set.push_back({ r.begin, std::min<char32_t>(r.end, 0xFF) });
+                        }
+                      catch(std::runtime_error &)
+                        {
+                          return; // set operations with other tests
+                        }
+
+                      a.emit({ 0x48, 0x39, 0xF2 }); // cmp rdx, rsi
+                      a.jcc(assembler::jae, next[c]);
+                      a.emit({ 0x0F, 0xB6, 0x04, 0x17 }); // movzx eax, byte [rdi+rdx]
+                      if(set.size() <= 3)
+                        {
+                          for(auto &r : set)
+                            if(r.begin == r.end)
+                              {
+                                a.emit({ 0x3D }); // cmp eax, begin
+                                a.imm32(r.begin);
+                                a.jcc(assembler::je, ok);
+                              }
+                            else
+                              {
+                                a.emit({ 0x44, 0x8D, 0x90 }); // lea r10d, [rax-begin]
+                                a.imm32(-r.begin);
+                                a.emit({ 0x41, 0x81, 0xFA }); // cmp r10d, end-begin
+                                a.imm32(r.end - r.begin);
+                                a.jcc(assembler::jbe, ok);
+                              }
+                          a.jmp(next[c]);
+                        }
+                      else
+                        {
+                          std::vector<uint8_t> bitmap(32, 0);
+                          for(auto &r : set)
+                            for(char32_t ch = r.begin; ch <= r.end; ch++)
+                              bitmap[ch / 8] |= 1 << (ch % 8);
+                          auto it = bitmaps.find(bitmap);
+                          if(it == bitmaps.end())
+                            it = bitmaps.insert({ bitmap, a.label() }).first;
+                          a.emit({ 0x4C, 0x8D, 0x15 }); // lea r10, [rip+bitmap]
+                          a.rel32(it->second);
+                          a.emit({ 0x41, 0x0F, 0xA3, 0x02 }); // bt [r10], eax
+                          a.jcc(assembler::jae, next[c]);
+                        }
+                      a.bind(ok);
+                      a.emit({ 0x48, 0x8D, 0x42, 0x01 }); // lea rax, [rdx+1]
+                    }
+                    break;
+
+                  default:
+                    return;
+                  }
+
+                // push a frame, atomic states give up when resumed
+                a.emit({ 0x4D, 0x39, 0xC1 }); // cmp r9, r8
+                a.jcc(assembler::jae, overflow);
+                a.emit({ 0x4C, 0x8D, 0x15 }); // lea r10, [rip+resume]
+                a.rel32(state.nonstop ? fail : next[c]);
+                a.emit({ 0x4D, 0x89, 0x11 }); // mov [r9], r10
+                a.emit({ 0x49, 0x89, 0x51, 0x08 }); // mov [r9+8], rdx
+                a.emit({ 0x49, 0x83, 0xC1, 0x10 }); // add r9, 16
+                a.emit({ 0x48, 0x89, 0xC2 }); // mov rdx, rax
+                a.jmp(state_labels[state.transitions[c].state]);
+              }
+            if(state.transitions.empty())
+              a.jmp(fail);
+          }
+      }
+
+  for(auto &bitmap : bitmaps)
+    {
+      a.bind(bitmap.second);
+      a.code.insert(a.code.end(), bitmap.first.begin(), bitmap.first.end());
+    }
+  a.resolve();
+
+  // written once, then only executed
+  std::shared_ptr<jit_code_t> code = std::make_shared<jit_code_t>();
+  code->size = a.code.size();
+  code->pages = mmap(nullptr, code->size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if(code->pages == MAP_FAILED)
+    {
+      code->pages = nullptr;
+      return;
+    }
+  std::memcpy(code->pages, a.code.data(), a.code.size());
+  if(mprotect(code->pages, code->size, PROT_READ | PROT_EXEC) != 0)
+    return;
+
+  jit_code = code;
+  for(unsigned int multiline = 0; multiline < 2; multiline++)
+    for(unsigned int fix_right = 0; fix_right < 2; fix_right++)
+      jit_entry[multiline][fix_right] = reinterpret_cast<jit_function>(
+        static_cast<uint8_t*>(code->pages) + entries[multiline][fix_right]);
+#endif
+}
+
+bool qre::jit_usable(const text &str, match_flag flags) const
+{
+  return jit_code && str.contiguous()
+    && (flags & (match_flag::partial | match_flag::utf8 | match_flag::longest))
+    == match_flag::none;
+}
+
+bool qre::jit_search(const text &str, match_flag flags, size_t begin,
+                     size_t &match_begin, size_t &match_end) const
+{
+  bool fix_left = (flags & match_flag::fix_left) != match_flag::none;
+  bool fix_right = (flags & match_flag::fix_right) != match_flag::none;
+  bool multiline = (flags & match_flag::multiline) != match_flag::none;
+  jit_function function = jit_entry[multiline][fix_right];
+  const uint8_t *data = reinterpret_cast<const uint8_t*>(str.data());
+
+  // the history starts on the call stack and grows on the heap by
+  // restarting with a larger one
+  jit_frame local[256];
+  std::unique_ptr<jit_frame[]> heap;
+  jit_frame *stack = local;
+  size_t frames = sizeof(local) / sizeof(local[0]);
+
+  // start positions like in backtrack()
+  size_t pos = begin;
+  while(true)
+    {
+      size_t end = function(data, str.length(), pos, stack, stack + frames);
+      if(end == jit_overflow)
+        {
+          frames *= 2;
+          heap.reset(new jit_frame[frames]);
+          stack = heap.get();
+          continue;
+        }
+      if(end != jit_no_match)
+        {
+          match_begin = pos;
+          match_end = end;
+          return true;
+        }
+      if(fix_left || pos >= str.length())
+        return false;
+      pos++;
+      if(prefix[false].size() && !prefilter(str, false, pos))
+        return false;
+    }
+}
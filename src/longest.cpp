@@ -0,0 +1,143 @@
+/*
+ * Copyright 2016 Nils Christopher Brause
+ *
+ * This file is part of libqre.
+ *
+ * libqre is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libqre is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libqre.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <qre.hpp>
+#include <algorithm>
+
+void qre::longest_compile()
+{
+  // bytes a single transition may consume
+  auto width = [] (const test_t &test) -> unsigned int
+    {
+      switch(test.type)
+        {
+        case test_t::test_type::epsilon:
+        case test_t::test_type::bol:
+          return 0;
+        case test_t::test_type::eol:
+          return 1; // newline in multiline mode
+        case test_t::test_type::newline:
+          if(!test.neg)
+            return 2; // CRLF
+          // fall through
+        case test_t::test_type::any:
+        case test_t::test_type::character:
+          {
+            charset_t cs = charset(test, false);
+            if(cs.empty())
+              return 0;
+            char32_t ch = cs.back().end;
+            return ch < 0x80 ? 1 : ch < 0x800 ? 2 : ch < 0x10000 ? 3 : 4;
+          }
+        default:
+          return infinite_length; // backreferences
+        }
+    };
+
+  auto add = [] (unsigned int a, unsigned int b) -> unsigned int
+    {
+      if(a == infinite_length || b == infinite_length)
+        return infinite_length;
+      return a + b;
+    };
+
+  // strongly connected components (Tarjan) are completed in reverse
+  // topological order, so all successors are known when a component is done
+  const unsigned int n = states.size();
+  max_length.assign(n, 0);
+  std::vector<unsigned int> index(n, infinite_length);
+  std::vector<unsigned int> lowlink(n, 0);
+  std::vector<bool> onstack(n, false);
+  std::vector<unsigned int> owner(n, infinite_length); // component root
+  std::vector<unsigned int> component;
+  std::vector<std::pair<unsigned int, unsigned int>> calls; // state, transition
+  unsigned int counter = 0;
+
+  for(unsigned int root = 0; root < n; root++)
+    {
+      if(index[root] != infinite_length)
+        continue;
+
+      calls.push_back({ root, 0 });
+      while(calls.size())
+        {
+          unsigned int v = calls.back().first;
+          unsigned int &t = calls.back().second;
+          const state_t *state = &states[v];
+
+          if(t == 0 && index[v] == infinite_length)
+            {
+              index[v] = lowlink[v] = counter++;
+              component.push_back(v);
+              onstack[v] = true;
+            }
+
+          // descend
+          if(t < state->transitions.size())
+            {
+              unsigned int w = state->transitions[t++].state;
+              if(index[w] == infinite_length)
+                calls.push_back({ w, 0 });
+              else if(onstack[w])
+                lowlink[v] = std::min(lowlink[v], index[w]);
+              continue;
+            }
+
+          // component complete
+          if(lowlink[v] == index[v])
+            {
+              std::vector<unsigned int> members;
+              unsigned int w;
+              do
+                {
+                  w = component.back();
+                  component.pop_back();
+                  onstack[w] = false;
+                  owner[w] = v;
+                  members.push_back(w);
+                }
+              while(w != v);
+
+              unsigned int length = 0;
+              for(auto &m : members)
+                for(auto &tr : states[m].transitions)
+                  {
+                    unsigned int w = width(tr.test);
+                    unsigned int target = tr.state;
+                    if(owner[target] != v)
+                      length = std::max(length, add(w, max_length[target]));
+                    // consuming cycle
+                    else if(w > 0)
+                      length = infinite_length;
+                  }
+              for(auto &m : members)
+                max_length[m] = length;
+            }
+
+          calls.pop_back();
+          if(calls.size())
+            {
+              unsigned int u = calls.back().first;
+              lowlink[u] = std::min(lowlink[u], lowlink[v]);
+            }
+        }
+    }
+}
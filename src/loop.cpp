@@ -0,0 +1,185 @@
+/*
+ * Copyright 2016 Nils Christopher Brause
+ *
+ * This file is part of libqre.
+ *
+ * libqre is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libqre is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libqre.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <qre.hpp>
+
+void qre::loop_compile()
+{
+  loops.clear();
+  for(auto &state : states)
+    state.loop = no_state;
+
+  // transitions into each state
+  std::vector<unsigned int> entries(states.size(), 0);
+  for(auto &state : states)
+    for(auto &t : state.transitions)
+      entries[t.state]++;
+
+  // head and continuation choose the body first, then the exit
+  auto choice = [this] (const state_t &state) -> bool
+    {
+      return state.id != the_chain.end && !state.nonstop && !state.begin_capture
+        && state.transitions.size() == 2
+        && state.transitions[0].test.type == test_t::test_type::epsilon
+        && state.transitions[1].test.type == test_t::test_type::epsilon;
+    };
+
+  for(auto &head : states)
+    {
+      if(!choice(head) || head.loop != no_state)
+        continue;
+      state_t &body = states[head.transitions[0].state];
+      unsigned int exit = head.transitions[1].state;
+      if(body.id == head.id || exit == head.id || exit == body.id
+         || body.id == the_chain.end || body.nonstop
+         || body.begin_capture || body.transitions.size() != 1 || entries[body.id] != 2)
+        continue;
+
+      // tests that consume exactly one character
+      const test_t &test = body.transitions[0].test;
+      if(test.type != test_t::test_type::any && test.type != test_t::test_type::character
+         && !(test.type == test_t::test_type::newline && test.neg))
+        continue;
+
+      // a run appended at once reads the same as one appended character by
+      // character, unless nested groups of the same name share a capture
+      bool shared = false;
+      for(unsigned int a = 0; a < body.captures.size(); a++)
+        for(unsigned int b = 0; b < a; b++)
+          if(body.captures[a].named == body.captures[b].named
+             && (body.captures[a].named ? body.captures[a].name == body.captures[b].name
+                 : body.captures[a].number == body.captures[b].number))
+            shared = true;
+      if(shared)
+        continue;
+
+      const state_t &next = states[body.transitions[0].state];
+      if(next.id == head.id || next.id == body.id || !choice(next) || entries[next.id] != 1
+         || next.transitions[0].state != body.id || next.transitions[1].state != exit)
+        continue;
+
+      loop_t loop;
+      loop.head = head.id;
+      loop.body = body.id;
+      loop.exit = exit;
+      loop.test = &test;
+      for(unsigned int multiline = 0; multiline < 2; multiline++)
+        {
+          charset_t set = charset(test, multiline);
+          loop.possessive[multiline] = loop_possessive(exit, set, multiline);
+          std::vector<bool> bytes(256, false);
+          std::vector<bool> ascii(256, false);
+          for(auto &r : set)
+            for(char32_t ch = r.begin; ch <= std::min<char32_t>(r.end, 0xFF); ch++)
+              {
+                bytes[ch] = true;
+                ascii[ch] = ch < 0x80;
+              }
+          loop.bytes[multiline] = byte_class(bytes);
+          loop.ascii[multiline] = byte_class(ascii);
+        }
+
+      head.loop = body.loop = loops.size();
+      loops.push_back(loop);
+    }
+}
+
+bool qre::loop_possessive(unsigned int exit, const charset_t &set, bool multiline) const
+{
+  // Every character given back is one of 'set' and would be the next one
+  // after the exit. Only zero-width paths to the end could pass it, and
+  // those reach the end after the whole run as well, unless they test for
+  // the beginning of a line.
+  std::vector<uint8_t> seen(states.size(), 0); // 1 directly, 2 after "^"
+  std::stack<std::pair<unsigned int, bool>> todo;
+  todo.push({ exit, false });
+  while(todo.size())
+    {
+      unsigned int state = todo.top().first;
+      bool bol = todo.top().second;
+      todo.pop();
+      if(seen[state] & (bol ? 2 : 1))
+        continue;
+      seen[state] |= bol ? 2 : 1;
+
+      if(state == the_chain.end)
+        {
+          if(bol)
+            return false;
+          continue;
+        }
+
+      for(auto &t : states[state].transitions)
+        switch(t.test.type)
+          {
+          case test_t::test_type::epsilon:
+            todo.push({ t.state, bol });
+            break;
+          case test_t::test_type::bol:
+            todo.push({ t.state, true });
+            break;
+          case test_t::test_type::eol:
+            // before the end only a newline passes
+            if(multiline && !charset_disjoint(set, { { '\n', '\n' } }))
+              return false;
+            break;
+          case test_t::test_type::newline:
+            if(!charset_disjoint(set, t.test.neg ? charset(t.test, multiline)
+                                 : charset_t({ { '\n', '\n' }, { '\r', '\r' } })))
+              return false;
+            break;
+          case test_t::test_type::any:
+          case test_t::test_type::character:
+            if(!charset_disjoint(set, charset(t.test, multiline)))
+              return false;
+            break;
+          default:
+            return false; // backreferences
+          }
+    }
+  return true;
+}
+
+size_t qre::loop_run(const loop_t &loop, const text &str, size_t pos, size_t limit,
+                     bool multiline, bool utf8, match &match_sofar) const
+{
+  const byte_class_t &bytes = utf8 ? loop.ascii[multiline] : loop.bytes[multiline];
+  while(pos < limit)
+    {
+      // within the segment around 'pos'
+      str[pos];
+      const uint8_t *window = reinterpret_cast<const uint8_t*>(str.window) - str.window_begin;
+      size_t n = std::min(limit, str.window_begin + str.window_length) - pos;
+      size_t run = class_run(bytes, window + pos, n);
+      pos += run;
+      if(run == n)
+        continue;
+
+      // other than ASCII characters are decoded
+      if(!utf8 || window[pos] < 0x80)
+        break;
+      size_t next = pos;
+      if(!check(*loop.test, str, next, multiline, utf8, match_sofar) || next > limit)
+        break;
+      pos = next;
+    }
+  return pos;
+}
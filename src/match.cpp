@@ -18,16 +18,39 @@
  *
  */
 
+#include <algorithm>
+#include <limits>
 #include <qre.hpp>
 
-bool qre::operator()(const std::string &str, match &result,
-                     match_flag flags) const
+bool qre::operator()(const text &str, match &result,
+                     match_flag flags, match_stats *stats,
+                     const match_limits *limits) const
 {
+  if(stats)
+    *stats = match_stats();
+
   // initialise match
   result.pos = 0;
   result.str = "";
   result.sub.clear();
+  result.named_sub.clear();
+  result.limit = limit_type::none;
+
+  bool found = run(str, result, input_flags(str, flags), stats, limits);
 
+  // the engines enter different groups on the way, so the entries of those
+  // that took no part in the match are added here for all of them
+  for(auto &c : capture_groups)
+    if(!c.named)
+      result.sub[c.number];
+    else
+      result.named_sub[c.name];
+  return found;
+}
+
+bool qre::run(const text &str, match &result, match_flag flags,
+              match_stats *stats, const match_limits *limits) const
+{
   // parameters
   bool partial = (flags & match_flag::partial) != match_flag::none;
   bool fix_left = (flags & match_flag::fix_left) != match_flag::none;
@@ -36,57 +59,440 @@ bool qre::operator()(const std::string &str, match &result,
   bool utf8 = (flags & match_flag::utf8) != match_flag::none;
   bool longest = (flags & match_flag::longest) != match_flag::none;
 
+  engine_type engine = select(flags, str.length());
+  if(engine == engine_type::none)
+    {
+      result.type = match_type::none;
+      return false;
+    }
+
+  if(engine == engine_type::onepass)
+    {
+      if(stats)
+        stats->engine = engine;
+      return onepass_match(str, result, multiline, utf8, true);
+    }
+
+  // searches begin at the first occurrence of the literal prefix, a literal
+  // at the end is looked for there
+  size_t begin = 0;
+  if(!fix_left && !partial && prefix[utf8].size()
+     && !(engine == engine_type::literal && fix_right)
+     && !prefilter(str, utf8, begin))
+    {
+      result.type = match_type::none;
+      return false;
+    }
+
+  if(stats)
+    stats->engine = engine;
+  switch(engine)
+    {
+    case engine_type::literal:
+    case engine_type::automaton:
+      {
+        size_t end = begin;
+        if(engine == engine_type::literal
+           ? !literal_match(str, fix_left, fix_right, utf8, begin, result.pos)
+           : !automaton_match(str, fix_left, fix_right, longest, multiline,
+                              utf8, begin, stats, result.pos, end))
+          {
+            result.type = match_type::none;
+            return false;
+          }
+        if(engine == engine_type::literal)
+          end = result.pos + prefix[utf8].length();
+        result.type = match_type::full;
+        result.str = str.substr(result.pos, end - result.pos);
+        return true;
+      }
+
+    case engine_type::automaton_backtrack:
+      {
+        // captures of the match found by the automaton
+        size_t end;
+        if(!automaton_match(str, fix_left, fix_right, longest, multiline,
+                            utf8, begin, stats, begin, end))
+          {
+            result.type = match_type::none;
+            return false;
+          }
+        flags = (flags & ~match_flag::longest) | match_flag::fix_left;
+        return stats ? backtrack<true, true>(str, result, flags, begin, end, stats, limits)
+          : backtrack<false, true>(str, result, flags, begin, end, nullptr, limits);
+      }
+
+    default:
+      // captures are needed only on the match
+      if(capturing && !backreferences && !partial)
+        {
+          size_t end;
+          if(!(stats ? backtrack<true, false>(str, result, flags, begin, no_end, stats, limits, &end)
+               : backtrack<false, false>(str, result, flags, begin, no_end, nullptr, limits, &end)))
+            return false;
+          flags = (flags & ~match_flag::longest) | match_flag::fix_left;
+          begin = result.pos;
+          return stats ? backtrack<true, true>(str, result, flags, begin, end, stats, limits)
+            : backtrack<false, true>(str, result, flags, begin, end, nullptr, limits);
+        }
+      return stats ? backtrack<true, true>(str, result, flags, begin, no_end, stats, limits)
+        : backtrack<false, true>(str, result, flags, begin, no_end, nullptr, limits);
+    }
+}
+
+bool qre::find(const text &str, match_flag flags, size_t start,
+               size_t &begin, size_t &end) const
+{
+  // parameters
+  bool partial = (flags & match_flag::partial) != match_flag::none;
+  bool fix_left = (flags & match_flag::fix_left) != match_flag::none;
+  bool fix_right = (flags & match_flag::fix_right) != match_flag::none;
+  bool multiline = (flags & match_flag::multiline) != match_flag::none;
+  bool utf8 = (flags & match_flag::utf8) != match_flag::none;
+  bool longest = (flags & match_flag::longest) != match_flag::none;
+
+  engine_type engine = select(flags, str.length() - start, false);
+  if(engine == engine_type::none)
+    return false;
+
+  // the one-pass matcher always starts at the beginning of the input
+  if(engine == engine_type::onepass && start > 0)
+    engine = engine_type::backtrack;
+
+  if(engine == engine_type::onepass)
+    {
+      match result;
+      if(!onepass_match(str, result, multiline, utf8, false))
+        return false;
+      begin = 0;
+      end = str.length();
+      return true;
+    }
+
+  // searches begin at the first occurrence of the literal prefix
+  if(!fix_left && !partial && prefix[utf8].size()
+     && !(engine == engine_type::literal && fix_right)
+     && !prefilter(str, utf8, start))
+    return false;
+
+  switch(engine)
+    {
+    case engine_type::literal:
+      if(!literal_match(str, fix_left, fix_right, utf8, start, begin))
+        return false;
+      end = begin + prefix[utf8].length();
+      return true;
+
+    case engine_type::automaton:
+    case engine_type::automaton_backtrack:
+      return automaton_match(str, fix_left, fix_right, longest, multiline,
+                             utf8, start, nullptr, begin, end);
+
+    default:
+      {
+        // backreferences depend on the captures
+        match result;
+        if(!(backreferences
+             ? backtrack<false, true>(str, result, flags, start, no_end,
+                                      nullptr, nullptr, &end)
+             : backtrack<false, false>(str, result, flags, start, no_end,
+                                       nullptr, nullptr, &end)))
+          return false;
+        begin = result.pos;
+        return true;
+      }
+    }
+}
+
+qre::match_flag qre::input_flags(const text &str, match_flag flags)
+{
+  // validate UTF-8 input once, so that the matchers can decode it blindly
+  if((flags & match_flag::assume_valid_utf8) != match_flag::none)
+    flags = flags | match_flag::utf8;
+  else if((flags & match_flag::utf8) != match_flag::none)
+    switch(validate_utf8(str))
+      {
+      case utf8_status::invalid:
+        throw std::runtime_error("Invalid UTF-8");
+      case utf8_status::ascii:
+        // bytes and characters coincide
+        flags = flags & ~match_flag::utf8;
+        break;
+      case utf8_status::valid:
+        break;
+      }
+  return flags;
+}
+
+template <bool collect, bool capture>
+bool qre::backtrack(const text &str, match &result, match_flag flags,
+                    size_t begin, size_t end, match_stats *stats,
+                    const match_limits *limits, size_t *match_end) const
+{
+  // machine code, if only the bounds or the matched string are needed
+  if(!collect && (!capture || !capturing) && !limits && end == no_end
+     && jit_usable(str, flags))
+    {
+      size_t match_begin, jit_end;
+      bool found = jit_search(str, flags, begin, match_begin, jit_end);
+#ifdef QRE_JIT_VERIFY
+      match reference;
+      size_t reference_end;
+      bool reference_found = backtrack<false, false, size_t>(
+        str, reference, flags, begin, end, nullptr, nullptr, &reference_end);
+      if(found != reference_found
+         || (found && (match_begin != reference.pos || jit_end != reference_end)))
+        throw std::logic_error("JIT and interpreter disagree on /" + source + "/");
+#endif
+      result.type = found ? match_type::full : match_type::none;
+      if(!found)
+        return false;
+      result.pos = match_begin;
+      if(capture)
+        result.str = str.substr(match_begin, jit_end - match_begin);
+      if(match_end)
+        *match_end = jit_end;
+      return true;
+    }
+
+  // the history takes 32 bit positions unless the input is longer
+  if(str.length() <= std::numeric_limits<uint32_t>::max())
+    return backtrack<collect, capture, uint32_t>(str, result, flags, begin, end,
+                                                 stats, limits, match_end);
+  return backtrack<collect, capture, size_t>(str, result, flags, begin, end,
+                                             stats, limits, match_end);
+}
+
+template <bool collect, bool capture, typename offset_t>
+bool qre::backtrack(const text &str, match &result, match_flag flags,
+                    size_t begin, size_t end, match_stats *stats,
+                    const match_limits *limits, size_t *match_end) const
+{
+  result.pos = begin;
+  if(collect)
+    stats->start_positions++;
+
+  // parameters
+  bool partial = (flags & match_flag::partial) != match_flag::none;
+  bool fix_left = (flags & match_flag::fix_left) != match_flag::none;
+  bool fix_right = (flags & match_flag::fix_right) != match_flag::none;
+  bool multiline = (flags & match_flag::multiline) != match_flag::none;
+  bool utf8 = (flags & match_flag::utf8) != match_flag::none;
+  bool longest = (flags & match_flag::longest) != match_flag::none;
+
+  if(fix_right)
+    end = str.length();
+
   // possible partial matches
   std::vector<match> partials;
 
-  // complete matches
-  std::vector<match> matches;
+  // longest match found so far
+  bool found = false;
+  match best;
+  size_t best_end = 0;
 
   // backtracking
   struct fsm_state
   {
-    std::shared_ptr<state_t> state; // current state
-    unsigned int pos; // position in input stream
+    const state_t *state; // current state
+    size_t pos; // position in input stream
     unsigned int transition; // last tried transition
   };
-  std::list<fsm_state> history;
+  // the same in the history
+  struct frame
+  {
+    const state_t *state;
+    offset_t pos;
+    unsigned int transition;
+  };
+  std::list<frame> history;
 
   // current FSM state
-  fsm_state current = { the_chain.begin, 0, 0 };
+  const state_t *final = &states[the_chain.end];
+  fsm_state current = { &states[the_chain.begin], begin, 0 };
+
+  // limits are looked at only when the step counter reaches 'checkpoint'
+  const uint64_t unlimited = ~static_cast<uint64_t>(0);
+  uint64_t steps = 0;
+  uint64_t checkpoint = unlimited;
+  uint64_t max_history = unlimited;
+  if(limits)
+    {
+      if(limits->max_steps)
+        checkpoint = limits->max_steps + 1;
+      if(limits->cancel || limits->deadline != std::chrono::steady_clock::time_point::max())
+        checkpoint = std::min(checkpoint, static_cast<uint64_t>(limit_interval));
+      if(limits->max_memory)
+        // list node with two links
+        max_history = limits->max_memory / (sizeof(frame) + 2 * sizeof(void*));
+    }
+  auto abort = [&result] (limit_type limit) -> bool
+    {
+      result.type = match_type::aborted;
+      result.limit = limit;
+      return false;
+    };
 
   // helper
-  unsigned int newpos;
+  size_t newpos;
 
   while(true)
     {
+      if(++steps >= checkpoint)
+        {
+          if(limits->max_steps && steps > limits->max_steps)
+            return abort(limit_type::steps);
+          if(limits->cancel && limits->cancel->load(std::memory_order_relaxed))
+            return abort(limit_type::cancelled);
+          if(std::chrono::steady_clock::now() >= limits->deadline)
+            return abort(limit_type::deadline);
+          checkpoint = steps + limit_interval;
+          if(limits->max_steps)
+            checkpoint = std::min(checkpoint, limits->max_steps + 1);
+        }
 #ifdef DEBUG
       std::cerr << "state " << current.state
                 << " (" << current.state->nonstop << ")" << std::endl;
       for(auto &t : current.state->transitions)
-        std::cerr << "  ->" << t.state.get() << std::endl;
+        std::cerr << "  ->" << t.state << std::endl;
 #endif
       // final state?
-      if(current.state == the_chain.end
+      if(current.state == final
          // -> accept if whole string is matched or in search mode
-         && (fix_right ? current.pos == str.size() : true))
+         && (end != no_end ? current.pos == end : true))
         {
 #ifdef DEBUG
           std::cerr << "accept" << std::endl << std::endl;
 #endif
           result.type = match_type::full;
 
-          if(longest)
-            matches.push_back(result);
+          if(!longest)
+            {
+              if(match_end)
+                *match_end = current.pos;
+              return true;
+            }
+
+          // remember longer matches only
+          if(!found || current.pos > best_end)
+            {
+              best = result;
+              best_end = current.pos;
+              found = true;
+            }
+
+          // nothing can be longer
+          if(current.pos == str.length())
+            {
+              result = best;
+              if(match_end)
+                *match_end = best_end;
+              return true;
+            }
+        }
+      // prune paths that cannot lead to a longer match
+      else if(longest && found && current.state != final
+              && max_length[current.state->id] != infinite_length
+              && current.pos + max_length[current.state->id]
+              <= best_end)
+        current.transition = current.state->transitions.size();
+
+      // greedy loops of a single character test, entered at their head or
+      // back at their body from the exit
+      if(!partial && current.state->loop != no_state
+         && current.transition == (current.state->id == loops[current.state->loop].head ? 0u : 1u))
+        {
+          const loop_t &loop = loops[current.state->loop];
+          const state_t *body = &states[loop.body];
+          const state_t *exit = &states[loop.exit];
+          if(current.state->id == loop.head)
+            {
+              // consume the whole run
+              if(collect)
+                stats->transitions++;
+              newpos = loop_run(loop, str, current.pos, end != no_end ? end : str.length(),
+                                multiline, utf8, result);
+              if(newpos == current.pos)
+                {
+                  if(collect)
+                    stats->checks_failed++;
+                  current.transition++;
+                  continue;
+                }
+
+              if(capture)
+                {
+                  for(auto &c : body->captures)
+                    if(!c.named)
+                      str.append_to(result.sub.at(c.number).back(),
+                                    current.pos, newpos-current.pos);
+                    else
+                      str.append_to(result.named_sub.at(c.name).back(),
+                                    current.pos, newpos-current.pos);
+                  str.append_to(result.str, current.pos, newpos-current.pos);
+                }
+
+              // the head and the end of the run, or for possessive loops
+              // both with no transitions left, so that the run is taken back
+              // at once
+              if(history.size() + 2 > max_history)
+                return abort(limit_type::memory);
+              if(loop.possessive[multiline])
+                {
+                  history.push_back({ current.state, static_cast<offset_t>(current.pos), 1 });
+                  history.push_back({ body, static_cast<offset_t>(current.pos), 1 });
+                }
+              else
+                {
+                  history.push_back({ current.state, static_cast<offset_t>(current.pos), 0 });
+                  history.push_back({ body, static_cast<offset_t>(newpos), 0 });
+                }
+              if(collect)
+                {
+                  stats->bytes_allocated += 2 * (sizeof(frame) + 2 * sizeof(void*));
+                  stats->max_history = std::max<uint64_t>(stats->max_history, history.size());
+                }
+            }
           else
-            return true;
+            {
+              // give back one character, the head tries the exit last
+              size_t start = history.back().pos;
+              newpos = current.pos - 1;
+              if(utf8)
+                while(newpos > start && (static_cast<uint8_t>(str[newpos]) & 0xC0) == 0x80)
+                  newpos--;
+              if(capture)
+                {
+                  size_t n = current.pos - newpos;
+                  for(auto &c : body->captures)
+                    if(!c.named)
+                      result.sub.at(c.number).back().erase(result.sub.at(c.number).back().length() - n, n);
+                    else
+                      result.named_sub.at(c.name).back().erase(result.named_sub.at(c.name).back().length() - n, n);
+                  result.str.erase(result.str.length() - n, n);
+                }
+
+              if(newpos == start)
+                {
+                  current = { history.back().state, start, 1 };
+                  history.pop_back();
+                  if(collect)
+                    stats->backtracks++;
+                  continue;
+                }
+              history.push_back({ body, static_cast<offset_t>(newpos), 0 });
+            }
+          current = { exit, newpos, 0 };
+          continue;
         }
+
       // transitions left?
-      if(current.state != the_chain.end && current.transition < current.state->transitions.size())
+      if(current.state != final && current.transition < current.state->transitions.size())
         {
           newpos = current.pos;
 
           // open capture group
-          if(current.state->begin_capture)
+          if(capture && current.state->begin_capture)
             {
               if(!current.state->captures.back().named)
                 result.sub[current.state->captures.back().number].push_back("");
@@ -105,22 +511,38 @@ bool qre::operator()(const std::string &str, match &result,
                     << current.state->transitions.size() << std::endl;
 #endif
           // test transition
+          if(collect)
+            stats->transitions++;
           if(check(current.state->transitions.at(current.transition).test, str, newpos, multiline, utf8, result))
             {
 #ifdef DEBUG
               std::cerr << "test succeeded" << std::endl;
 #endif
               // record captures
-              for(auto &c : current.state->captures)
-                if(!c.named)
-                  result.sub.at(c.number).back().append(str.substr(current.pos, newpos-current.pos));
-                else
-                  result.named_sub.at(c.name).back().append(str.substr(current.pos, newpos-current.pos));
-              result.str.append(str.substr(current.pos, newpos-current.pos));
+              if(capture)
+                {
+                  for(auto &c : current.state->captures)
+                    if(!c.named)
+                      str.append_to(result.sub.at(c.number).back(),
+                                    current.pos, newpos-current.pos);
+                    else
+                      str.append_to(result.named_sub.at(c.name).back(),
+                                    current.pos, newpos-current.pos);
+                  str.append_to(result.str, current.pos, newpos-current.pos);
+                }
 
               // successful test -> advance state
-              history.push_back(current);
-              current.state = current.state->transitions.at(current.transition).state;
+              if(history.size() >= max_history)
+                return abort(limit_type::memory);
+              history.push_back({ current.state, static_cast<offset_t>(current.pos),
+                                  current.transition });
+              if(collect)
+                {
+                  // list node with two links
+                  stats->bytes_allocated += sizeof(frame) + 2 * sizeof(void*);
+                  stats->max_history = std::max<uint64_t>(stats->max_history, history.size());
+                }
+              current.state = &states[current.state->transitions.at(current.transition).state];
               current.transition = 0;
               current.pos = newpos;
             }
@@ -130,6 +552,8 @@ bool qre::operator()(const std::string &str, match &result,
 #ifdef DEBUG
               std::cerr << "test failed" << std::endl;
 #endif
+              if(collect)
+                stats->checks_failed++;
               current.transition++;
             }
         }
@@ -137,7 +561,7 @@ bool qre::operator()(const std::string &str, match &result,
       else
         {
           // partial match?
-          if(partial && current.state != the_chain.end && current.pos == str.length())
+          if(partial && current.state != final && current.pos == str.length())
             {
               result.type = match_type::partial;
               partials.push_back(result);
@@ -156,32 +580,46 @@ bool qre::operator()(const std::string &str, match &result,
                   newpos = current.pos;
 
                   // reverting state
-                  current = history.back();
+                  current = { history.back().state, history.back().pos,
+                              history.back().transition };
                   current.transition++; // next transition
 
                   // uncapture
-                  for(auto &c : current.state->captures)
-                    if(!c.named)
-                      result.sub.at(c.number).back().erase(result.sub.at(c.number).back().length()
-                                                           -(newpos-current.pos), newpos-current.pos);
-                    else
-                      result.named_sub.at(c.name).back().erase(result.named_sub.at(c.name).back().length()
+                  if(capture)
+                    {
+                      for(auto &c : current.state->captures)
+                        if(!c.named)
+                          result.sub.at(c.number).back().erase(result.sub.at(c.number).back().length()
                                                                -(newpos-current.pos), newpos-current.pos);
+                        else
+                          result.named_sub.at(c.name).back().erase(result.named_sub.at(c.name).back().length()
+                                                                   -(newpos-current.pos), newpos-current.pos);
 
-                  if(current.state->begin_capture)
-                    {
-                      if(!current.state->captures.back().named)
-                        result.sub.at(current.state->captures.back().number).pop_back();
-                      else
-                        result.named_sub.at(current.state->captures.back().name).pop_back();
-                    }
+                      if(current.state->begin_capture)
+                        {
+                          if(!current.state->captures.back().named)
+                            result.sub.at(current.state->captures.back().number).pop_back();
+                          else
+                            result.named_sub.at(current.state->captures.back().name).pop_back();
+                        }
 
-                  result.str.erase(result.str.length()-(newpos-current.pos), newpos-current.pos);
+                      result.str.erase(result.str.length()-(newpos-current.pos), newpos-current.pos);
+                    }
 
                   history.pop_back();
+                  if(collect)
+                    stats->backtracks++;
                 }
               while(current.state->nonstop);
             }
+          // leftmost-longest match
+          else if(found)
+            {
+              result = best;
+              if(match_end)
+                *match_end = best_end;
+              return true;
+            }
           // try next starting point if in search mode
           else if(!fix_left && current.pos < str.size())
             {
@@ -189,24 +627,21 @@ bool qre::operator()(const std::string &str, match &result,
               std::cerr << "advance" << std::endl << std::endl;
 #endif
               current.transition = 0;
+              if(collect)
+                stats->start_positions++;
               if(utf8)
-                {
-                  advance(str, current.pos);
-                  result.pos = current.pos;
-                }
+                advance(str, current.pos);
               else
+                current.pos++;
+
+              // skip to the next occurrence of the literal prefix
+              if(!partial && prefix[utf8].size()
+                 && !prefilter(str, utf8, current.pos))
                 {
-                  current.pos++;
-                  result.pos++;
+                  result.type = match_type::none;
+                  return false;
                 }
-            }
-          // choose the longest match
-          else if(matches.size() > 0)
-            {
-              for(auto &m : matches)
-                if(m.str.size() > result.str.size())
-                  result = m;
-              return true;
+              result.pos = current.pos;
             }
           // partial match?
           else if(partials.size() > 0)
@@ -216,6 +651,8 @@ bool qre::operator()(const std::string &str, match &result,
 #endif
               result = partials.front();
               result.type = match_type::partial;
+              if(match_end)
+                *match_end = str.length();
               return true;
             }
           // no match at all
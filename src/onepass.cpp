@@ -0,0 +1,223 @@
+/*
+ * Copyright 2016 Nils Christopher Brause
+ *
+ * This file is part of libqre.
+ *
+ * libqre is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libqre is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libqre.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <qre.hpp>
+
+void qre::onepass_compile()
+{
+  onepass.clear();
+  onepass_eol = false;
+
+  // atomic groups depend on backtracking order
+  for(auto &state : states)
+    if(state.nonstop)
+      return;
+
+  std::vector<std::vector<onepass_leaf_t>> table(states.size());
+  std::vector<bool> done(states.size(), false);
+  std::vector<unsigned int> visited(states.size(), states.size());
+  std::stack<unsigned int> todo;
+  todo.push(the_chain.begin);
+
+  while(todo.size())
+    {
+      unsigned int root = todo.top();
+      todo.pop();
+      if(done[root])
+        continue;
+      done[root] = true;
+
+      // depth first search along zero-width transitions
+      std::vector<const state_t*> path;
+      std::vector<unsigned int> next; // next transition per path entry
+      std::vector<const test_t*> asserts;
+      std::vector<unsigned int> nasserts; // asserts before path entry
+
+      auto enter = [&] (const state_t *state, unsigned int n) -> bool
+        {
+          // more than one path to the same state
+          if(visited[state->id] == root)
+            return false;
+          visited[state->id] = root;
+          path.push_back(state);
+          next.push_back(0);
+          nasserts.push_back(n);
+          return true;
+        };
+
+      enter(&states[root], 0);
+      while(path.size())
+        {
+          const state_t *state = path.back();
+
+          // accepting leaf
+          if(state == &states[the_chain.end])
+            {
+              onepass_leaf_t leaf;
+              leaf.path.assign(path.begin(), path.end()-1);
+              leaf.asserts = asserts;
+              table[root].push_back(leaf);
+            }
+
+          // all transitions visited
+          if(state == &states[the_chain.end] || next.back() >= state->transitions.size())
+            {
+              asserts.resize(nasserts.back());
+              path.pop_back();
+              next.pop_back();
+              nasserts.pop_back();
+              continue;
+            }
+
+          const transition_t &t = state->transitions.at(next.back()++);
+          unsigned int n = asserts.size();
+          switch(t.test.type)
+            {
+            case test_t::test_type::epsilon:
+              if(!enter(&states[t.state], n))
+                return;
+              break;
+
+            case test_t::test_type::eol:
+              onepass_eol = true;
+              // fall through
+            case test_t::test_type::bol:
+              asserts.push_back(&t.test);
+              if(!enter(&states[t.state], n))
+                return;
+              break;
+
+            case test_t::test_type::newline:
+              if(!t.test.neg)
+                return; // "\R" may consume one or two characters
+              // fall through
+            case test_t::test_type::any:
+            case test_t::test_type::character:
+              {
+                onepass_leaf_t leaf;
+                leaf.path = path;
+                leaf.asserts = asserts;
+                leaf.test = &t.test;
+                leaf.target = t.state;
+                table[root].push_back(leaf);
+                todo.push(leaf.target);
+              }
+              break;
+
+            default:
+              return; // backreferences depend on the path taken
+            }
+        }
+
+      // at most one leaf may proceed on any character
+      charset_t seen;
+      bool accepting = false;
+      for(auto &leaf : table[root])
+        if(leaf.test)
+          {
+            charset_t cs = charset(*leaf.test, false);
+            if(!charset_disjoint(seen, cs))
+              return;
+            seen = charset_union(seen, cs);
+          }
+        else if(accepting)
+          return;
+        else
+          accepting = true;
+    }
+
+#ifdef DEBUG
+  std::cerr << "pattern is one-pass" << std::endl;
+#endif
+  onepass.swap(table);
+}
+
+bool qre::onepass_match(const text &str, match &result,
+                        bool multiline, bool utf8, bool capture) const
+{
+  // there is only one path, so captures are recorded on the way
+  unsigned int state = the_chain.begin;
+  size_t pos = 0;
+  size_t newpos = 0;
+  while(true)
+    {
+      const onepass_leaf_t *next = nullptr;
+      for(auto &leaf : onepass.at(state))
+        {
+          bool ok = true;
+          for(auto &a : leaf.asserts)
+            {
+              size_t tmp = pos;
+              if(!check(*a, str, tmp, multiline, utf8, result))
+                {
+                  ok = false;
+                  break;
+                }
+            }
+          if(!ok)
+            continue;
+
+          newpos = pos;
+          if(leaf.test ? check(*leaf.test, str, newpos, multiline, utf8, result)
+             : pos == str.length())
+            {
+              next = &leaf;
+              break;
+            }
+        }
+
+      if(!next)
+        {
+          result.sub.clear();
+          result.named_sub.clear();
+          result.type = match_type::none;
+          return false;
+        }
+
+      if(capture)
+        for(auto &s : next->path)
+          if(s->begin_capture)
+            {
+              if(!s->captures.back().named)
+                result.sub[s->captures.back().number].push_back("");
+              else
+                result.named_sub[s->captures.back().name].push_back("");
+            }
+      if(!next->test)
+        break;
+
+      if(capture)
+        for(auto &cap : next->path.back()->captures)
+          {
+            if(!cap.named)
+              str.append_to(result.sub.at(cap.number).back(), pos, newpos-pos);
+            else
+              str.append_to(result.named_sub.at(cap.name).back(), pos, newpos-pos);
+          }
+      state = next->target;
+      pos = newpos;
+    }
+
+  if(capture)
+    result.str = str.substr(0);
+  result.type = match_type::full;
+  return true;
+}
@@ -18,145 +18,227 @@
  *
  */
 
+#include <algorithm>
 #include <qre.hpp>
 
-qre::chain_t qre::parse_atom(std::list<symbol> &syms)
+qre::chain_t qre::parse(const tokens_t &tokens)
 {
-  // an atom is either a single test...
-  if(syms.size() && syms.front().type == symbol::type_t::test)
-    {
-      chain_t result;
-      result.begin = std::make_shared<state_t>();
-      result.end = std::make_shared<state_t>();
-      transition_t transition;
-      transition.test = syms.front().test;
-      transition.state = result.end;
-      result.begin->transitions.push_back(transition);
-      result.end->prev.push_back(result.begin);
-      result.begin->captures = captures;
-      result.begin->nonstop = nonstop;
-      syms.pop_front();
-      return result;
-    }
-  // ...or a parenthesised group expression
-  else if(syms.size() && syms.front().type == symbol::type_t::lparan)
+  const std::vector<symbol> &syms = tokens.syms;
+
+  // expression being parsed per group
+  struct frame_t
+  {
+    chain_t term; // current term
+    chain_t alt; // alternation of the previous terms
+    const symbol *group; // opening parenthesis
+    bool nonstop; // outside of the group
+  };
+  std::vector<frame_t> frames(1);
+  frames.back().group = nullptr;
+
+  unsigned int pos = 0;
+  bool start = true; // at the beginning of an expression
+  while(true)
     {
-      // get options
-      bool capture = syms.front().capture;
-      bool atomic = syms.front().atomic;
-      bool named = syms.front().named;
-      std::string name = syms.front().name;
-      syms.pop_front();
-
-      // new capture group
-      if(capture)
+      frame_t &frame = frames.back();
+      if(start)
         {
-          if(named)
-            captures.push_back({ true, 0, name });
-          else
-            captures.push_back({ false, id++, "" });
+          frame.term = parse_literals(tokens, pos);
+          start = false;
         }
+      const symbol *sym = pos < syms.size() ? &syms[pos] : nullptr;
 
-      // start atomic group
-      bool oldnonstop = nonstop;
-      if(atomic)
-        nonstop = true;
-
-      // parse group contents
-      chain_t result = parse_expression(syms);
-      if(!result)
-        throw std::runtime_error("Expected expression after '('.");
-      if(!syms.size() || syms.front().type != symbol::type_t::rparan)
-        throw std::runtime_error("Expected ')'.");
-      syms.pop_front();
-
-      // end of atomic group
-      if(atomic)
-        nonstop = oldnonstop;
-
-      // Append/Prepend epsilon transition
-      std::shared_ptr<state_t> tmp = std::make_shared<state_t>();
-      tmp->nonstop = nonstop;
-      epsilon(tmp, result.begin);
-      result.begin = tmp;
-      tmp = std::make_shared<state_t>();
-      //tmp->nonstop = nonstop;
-      epsilon(result.end, tmp);
-      result.end = tmp;
-
-      // capture information
-      if(capture)
+      // extend the term by a factor...
+      chain_t atom;
+      if(sym && sym->type == symbol::type_t::test)
         {
-          result.begin->begin_capture = true;
-          result.begin->captures = captures;
-          captures.pop_back();
+          atom = parse_test(tokens, *sym);
+          pos++;
+        }
+      // ...or descend into a group
+      else if(sym && sym->type == symbol::type_t::lparan)
+        {
+          // new capture group
+          if(sym->capture)
+            {
+              if(sym->named)
+                captures.push_back({ true, 0, tokens.names[sym->name] });
+              else
+                captures.push_back({ false, id++, "" });
+            }
+
+          // start atomic group
+          frames.push_back({ chain_t(), chain_t(), sym, nonstop });
+          if(sym->atomic)
+            nonstop = true;
+          pos++;
+          start = true;
+          continue;
+        }
+      else
+        {
+          // end of term
+          if(!frame.term)
+            {
+              if(frame.alt)
+                throw std::runtime_error("Expected expression after '|'.");
+              if(frame.group)
+                throw std::runtime_error("Expected expression after '('.");
+              throw std::runtime_error("Expected expression.");
+            }
+
+          // add alternations
+          if(frame.alt || (sym && sym->type == symbol::type_t::alt))
+            {
+              if(!frame.alt)
+                {
+                  frame.alt.begin = new_state();
+                  frame.alt.end = new_state();
+                }
+              epsilon(frame.alt.begin, frame.term.begin);
+              epsilon(frame.term.end, frame.alt.end);
+              frame.term = chain_t();
+              if(sym && sym->type == symbol::type_t::alt)
+                {
+                  pos++;
+                  continue;
+                }
+              frame.term = frame.alt;
+            }
+
+          // end of expression
+          chain_t result = frame.term;
+          if(!frame.group)
+            {
+              if(sym)
+                throw std::runtime_error("Unparsed tokens.");
+              return result;
+            }
+          if(!sym || sym->type != symbol::type_t::rparan)
+            throw std::runtime_error("Expected ')'.");
+          pos++;
+
+          // end of atomic group
+          bool capture = frame.group->capture;
+          nonstop = frame.nonstop;
+          frames.pop_back();
+
+          // Append/Prepend epsilon transition
+          unsigned int tmp = new_state();
+          states[tmp].nonstop = nonstop;
+          epsilon(tmp, result.begin);
+          result.begin = tmp;
+          tmp = new_state();
+          //states[tmp].nonstop = nonstop;
+          epsilon(result.end, tmp);
+          result.end = tmp;
+
+          // capture information
+          if(capture)
+            {
+              states[result.begin].begin_capture = true;
+              states[result.begin].captures = captures;
+              captures.pop_back();
+            }
+
+          atom = result;
         }
 
-      return result;
+      chain_t factor = parse_factor(atom, tokens, pos);
+      frame_t &outer = frames.back();
+      if(!outer.term)
+        outer.term = factor;
+      else
+        {
+          merge_state(outer.term.end, factor.begin);
+          outer.term.end = factor.end;
+        }
     }
-  return chain_t();
 }
 
-qre::chain_t qre::parse_factor(std::list<symbol> &syms)
+qre::chain_t qre::parse_test(const tokens_t &tokens, const symbol &sym)
 {
   chain_t result;
-  result.begin = std::make_shared<state_t>();
+  result.begin = new_state();
+  result.end = new_state();
+  transition_t transition;
+  transition.test = symbol_test(tokens, sym);
+  transition.state = result.end;
+  states[result.begin].transitions.push_back(transition);
+  states[result.begin].captures = captures;
+  states[result.begin].nonstop = nonstop;
+  return result;
+}
 
-  // parse an atom
-  chain_t atom = parse_atom(syms);
-  if(!atom)
-    return chain_t();
+qre::chain_t qre::parse_factor(chain_t atom, const tokens_t &tokens,
+                               unsigned int &pos)
+{
+  const std::vector<symbol> &syms = tokens.syms;
+  auto next = [&] (symbol::type_t type) -> bool
+    {
+      return pos < syms.size() && syms[pos].type == type;
+    };
+
+  chain_t result;
+  result.begin = new_state();
 
   // check for modifier
   range_t range;
-  if(syms.size() && syms.front().type == symbol::type_t::range)
+  if(next(symbol::type_t::range))
     {
-      range = syms.front().range;
-      syms.pop_front();
+      range = syms[pos].range;
+      pos++;
     }
-  else if(syms.size() && syms.front().type == symbol::type_t::qmark)
+  else if(next(symbol::type_t::qmark))
     {
       range.begin = 0;
       range.end = 1;
-      syms.pop_front();
+      pos++;
     }
-  else if(syms.size() && syms.front().type == symbol::type_t::star)
+  else if(next(symbol::type_t::star))
     {
       range.begin = 0;
       range.infinite = true;
-      syms.pop_front();
+      pos++;
     }
-  else if(syms.size() && syms.front().type == symbol::type_t::plus)
+  else if(next(symbol::type_t::plus))
     {
       range.begin = 1;
       range.infinite = true;
-      syms.pop_front();
+      pos++;
     }
 
   bool lazy = false;
-  if(syms.size() && syms.front().type == symbol::type_t::qmark)
+  if(next(symbol::type_t::qmark))
     {
       lazy = true;
-      syms.pop_front();
+      pos++;
     }
 
+  // the atom itself serves as its last copy, unless it becomes the loop
+  unsigned int copies = std::max(range.begin, range.end);
+  auto copy = [&] (unsigned int c) -> chain_t
+    {
+      return !range.infinite && c+1 == copies ? atom : clone(atom);
+    };
+
   // current chain position
-  std::shared_ptr<state_t> pos = result.begin;
+  unsigned int state = result.begin;
 
   // append minimum
   unsigned int c = 0;
   for(; c < range.begin; c++)
     {
-      chain_t tmp = clone(atom);
-      merge_state(pos, tmp.begin);
-      pos = tmp.end;
+      chain_t tmp = copy(c);
+      merge_state(state, tmp.begin);
+      state = tmp.end;
     }
 
   // append infinity
   if(range.infinite)
     {
-      std::shared_ptr<state_t> end = std::make_shared<state_t>();
-      epsilon(pos, atom.begin);
+      unsigned int end = new_state();
+      epsilon(state, atom.begin);
       if(lazy)
         {
           // skip first
@@ -169,17 +251,17 @@ qre::chain_t qre::parse_factor(std::list<symbol> &syms)
           epsilon(atom.end, atom.begin);
           epsilon(atom.end, end);
         }
-      epsilon(pos, end);
-      pos = end;
+      epsilon(state, end);
+      state = end;
     }
   // append maximum
   else
     for(; c < range.end; c++)
       {
-        chain_t tmp = clone(atom);
+        chain_t tmp = copy(c);
         if(lazy)
           {
-            std::shared_ptr<state_t> begin = std::make_shared<state_t>();
+            unsigned int begin = new_state();
             // skip first
             epsilon(begin, tmp.end);
             merge_state(begin, tmp.begin);
@@ -189,60 +271,155 @@ qre::chain_t qre::parse_factor(std::list<symbol> &syms)
           // skip last
           epsilon(tmp.begin, tmp.end);
 
-        merge_state(pos, tmp.begin);
-        pos = tmp.end;
+        merge_state(state, tmp.begin);
+        state = tmp.end;
       }
 
-  result.end = pos;
+  result.end = state;
   return result;
 }
 
-qre::chain_t qre::parse_term(std::list<symbol> &syms)
+qre::chain_t qre::parse_literals(const tokens_t &tokens, unsigned int &pos)
 {
-  chain_t chain = parse_factor(syms);
-  if(!chain)
+  // atomic groups depend on the order of the branches
+  if(nonstop)
     return chain_t();
 
-  // extend chain
-  chain_t tmp;
-  while((tmp = parse_factor(syms)))
+  // characters a test consumes, empty unless it is a small set of them
+  auto key = [] (const test_t &test) -> std::vector<char32_t>
     {
-      //epsilon(chain.end, tmp.begin);
-      merge_state(chain.end, tmp.begin);
-      chain.end = tmp.end;
-    }
+      std::vector<char32_t> chars;
+      if(test.type != test_t::test_type::character || test.neg
+         || test.subtractions.size() || test.intersections.size()
+         || test.categories || test.chars.size() > 4)
+        return chars;
+      chars.assign(test.chars.begin(), test.chars.end());
+      for(auto &r : test.ranges)
+        {
+          if(r.end - r.begin >= 4)
+            return std::vector<char32_t>();
+          for(char32_t ch = r.begin; ch <= r.end; ch++)
+            chars.push_back(ch);
+        }
+      if(chars.size() > 4)
+        return std::vector<char32_t>();
+      std::sort(chars.begin(), chars.end());
+      return chars;
+    };
 
-  return chain;
-}
+  // trie of the alternatives
+  struct node_t
+  {
+    std::map<char32_t, unsigned int> next; // child per character
+    std::vector<unsigned int> children; // in order of creation
+    std::vector<char32_t> chars; // characters leading here
+    const symbol *sym = nullptr; // symbol leading here
+    unsigned int word = ~0u; // first alternative ending here
+    unsigned int first = ~0u; // first alternative through here
+    unsigned int last = 0; // last alternative through here
+  };
+  std::vector<node_t> trie(1);
+  unsigned int node = 0;
+  unsigned int word = 0;
+  bool empty = true;
 
-qre::chain_t qre::parse_expression(std::list<symbol> &syms)
-{
-  chain_t tmp = parse_term(syms);
-  if(!tmp)
+  const std::vector<symbol> &syms = tokens.syms;
+  unsigned int end = pos;
+  for(; end < syms.size() && syms[end].type != symbol::type_t::rparan; end++)
+    {
+      const symbol *it = &syms[end];
+      if(it->type == symbol::type_t::alt)
+        {
+          if(empty)
+            return chain_t();
+          if(trie[node].word == ~0u)
+            trie[node].word = word;
+          node = 0;
+          word++;
+          empty = true;
+          continue;
+        }
+      if(it->type != symbol::type_t::test)
+        return chain_t();
+      std::vector<char32_t> chars;
+      if(it->test == no_test && !it->icase)
+        chars.push_back(it->ch);
+      else
+        chars = key(symbol_test(tokens, *it));
+      if(chars.empty())
+        return chain_t();
+
+      // siblings must not share characters
+      unsigned int child;
+      auto n = trie[node].next.find(chars.front());
+      if(n == trie[node].next.end())
+        {
+          for(auto ch : chars)
+            if(trie[node].next.count(ch))
+              return chain_t();
+          child = trie.size();
+          trie.emplace_back();
+          trie[child].chars = chars;
+          trie[child].sym = it;
+          for(auto ch : chars)
+            trie[node].next[ch] = child;
+          trie[node].children.push_back(child);
+        }
+      else if(trie[n->second].chars != chars)
+        return chain_t();
+      else
+        child = n->second;
+
+      node = child;
+      trie[node].first = std::min(trie[node].first, word);
+      trie[node].last = std::max(trie[node].last, word);
+      empty = false;
+    }
+  if(empty || word == 0)
     return chain_t();
+  if(trie[node].word == ~0u)
+    trie[node].word = word;
 
-  // add alternations
-  if(syms.size() && syms.front().type == symbol::type_t::alt)
-    {
-      chain_t result;
-      result.begin = std::make_shared<state_t>();
-      result.end = std::make_shared<state_t>();
+  // Only one child proceeds on a character, so the branches are tried in the
+  // order of the alternatives if no alternative ending at a node lies
+  // between two others passing through the same child.
+  for(auto &n : trie)
+    for(auto &c : n.children)
+      if(n.word != ~0u && trie[c].first < n.word && n.word < trie[c].last)
+        return chain_t();
 
-      epsilon(result.begin, tmp.begin);
-      epsilon(tmp.end, result.end);
+  // states
+  chain_t result;
+  std::vector<unsigned int> state(trie.size());
+  for(auto &s : state)
+    {
+      s = new_state();
+      states[s].captures = captures;
+      states[s].nonstop = nonstop;
+    }
+  result.begin = state[0];
+  result.end = new_state();
 
-      while(syms.size() && syms.front().type == symbol::type_t::alt)
+  for(unsigned int c = 0; c < trie.size(); c++)
+    {
+      // accepting before the children containing later alternatives only
+      bool accepted = trie[c].word == ~0u;
+      for(auto &child : trie[c].children)
         {
-          syms.pop_front();
-          tmp = parse_term(syms);
-          if(!tmp)
-            throw std::runtime_error("Expected expression after '|'.");
-
-          epsilon(result.begin, tmp.begin);
-          epsilon(tmp.end, result.end);
+          if(!accepted && trie[child].first > trie[c].word)
+            {
+              epsilon(state[c], result.end);
+              accepted = true;
+            }
+          transition_t transition;
+          transition.test = symbol_test(tokens, *trie[child].sym);
+          transition.state = state[child];
+          states[state[c]].transitions.push_back(transition);
         }
-      return result;
+      if(!accepted)
+        epsilon(state[c], result.end);
     }
-  else
-    return tmp;
+
+  pos = end;
+  return result;
 }
@@ -0,0 +1,157 @@
+/*
+ * Copyright 2016 Nils Christopher Brause
+ *
+ * This file is part of libqre.
+ *
+ * libqre is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libqre is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libqre.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <qre.hpp>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+void qre::prefilter_compile()
+{
+  for(unsigned int utf8 = 0; utf8 < 2; utf8++)
+    {
+      prefix[utf8].clear();
+      prefix_mask[utf8].clear();
+
+      // follow the transitions every match has to take
+      const state_t *state = &states[the_chain.begin];
+      for(unsigned int c = 0; c < states.size() && state->transitions.size() == 1; c++)
+        {
+          const transition_t &t = state->transitions.front();
+          state = &states[t.state];
+          if(t.test.type == test_t::test_type::epsilon)
+            continue;
+          else if(t.test.type != test_t::test_type::character)
+            break;
+
+          // characters that can be bytes
+          charset_t set = charset(t.test, false);
+          if(!utf8)
+            set = charset_intersect(set, { { 0, 0xFF } });
+
+          // single ASCII characters and ASCII letters of either case
+          if(set.size() == 1 && set[0].begin == set[0].end && set[0].begin < 0x80)
+            {
+              prefix[utf8].push_back(set[0].begin);
+              prefix_mask[utf8].push_back(0);
+            }
+          else if(set.size() == 2 && set[0].begin == set[0].end
+                  && set[1].begin == set[1].end && 'A' <= set[0].begin
+                  && set[0].begin <= 'Z' && set[1].begin == set[0].begin + 32)
+            {
+              prefix[utf8].push_back(set[1].begin);
+              prefix_mask[utf8].push_back(0x20);
+            }
+          else
+            break;
+        }
+    }
+}
+
+// first occurrence of the literal at or after pos in a contiguous piece
+static bool scan(const uint8_t *data, size_t length, const uint8_t *literal,
+                 const uint8_t *mask, size_t n, size_t &pos)
+{
+  // bytes between the first and the last one
+  auto verify = [&] (size_t p) -> bool
+    {
+      for(size_t c = 1; c+1 < n; c++)
+        if((data[p+c] | mask[c]) != literal[c])
+          return false;
+      return true;
+    };
+
+  size_t p = pos;
+#ifdef __SSE2__
+  // compare the first and the last byte of 16 positions at once
+  const __m128i first = _mm_set1_epi8(literal[0]);
+  const __m128i first_mask = _mm_set1_epi8(mask[0]);
+  const __m128i last = _mm_set1_epi8(literal[n-1]);
+  const __m128i last_mask = _mm_set1_epi8(mask[n-1]);
+  for(; p + n-1 + 16 <= length; p += 16)
+    {
+      __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + p));
+      __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + p + n-1));
+      unsigned int candidates = _mm_movemask_epi8(
+        _mm_and_si128(_mm_cmpeq_epi8(_mm_or_si128(a, first_mask), first),
+                      _mm_cmpeq_epi8(_mm_or_si128(b, last_mask), last)));
+      while(candidates)
+        {
+          unsigned int c = __builtin_ctz(candidates);
+          if(verify(p + c))
+            {
+              pos = p + c;
+              return true;
+            }
+          candidates &= candidates - 1;
+        }
+    }
+#endif
+
+  for(; p + n <= length; p++)
+    if((data[p] | mask[0]) == literal[0]
+       && (data[p+n-1] | mask[n-1]) == literal[n-1] && verify(p))
+      {
+        pos = p;
+        return true;
+      }
+  return false;
+}
+
+bool qre::prefilter(const text &str, bool utf8, size_t &pos) const
+{
+  const uint8_t *literal = reinterpret_cast<const uint8_t*>(prefix[utf8].data());
+  const uint8_t *mask = reinterpret_cast<const uint8_t*>(prefix_mask[utf8].data());
+  const size_t n = prefix[utf8].length();
+
+  if(str.contiguous())
+    return scan(reinterpret_cast<const uint8_t*>(str.data()), str.length(),
+                literal, mask, n, pos);
+
+  // occurrences within a segment, then those crossing into the next ones
+  for(auto &seg : str.segments)
+    {
+      size_t end = seg.first + seg.second.length;
+      if(end <= pos)
+        continue;
+      size_t p = std::max(pos, seg.first) - seg.first;
+      if(scan(reinterpret_cast<const uint8_t*>(seg.second.data),
+              seg.second.length, literal, mask, n, p))
+        {
+          pos = seg.first + p;
+          return true;
+        }
+      for(p = std::max(pos, std::max(seg.first + n-1, end) - (n-1));
+          p < end && p + n <= str.length(); p++)
+        {
+          size_t c = 0;
+          while(c < n && (static_cast<uint8_t>(str[p+c]) | mask[c]) == literal[c])
+            c++;
+          if(c == n)
+            {
+              pos = p;
+              return true;
+            }
+        }
+    }
+  return false;
+}
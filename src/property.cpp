@@ -0,0 +1,184 @@
+/*
+ * Copyright 2016 Nils Christopher Brause
+ *
+ * This file is part of libqre.
+ *
+ * libqre is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libqre is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libqre.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <qre.hpp>
+
+namespace
+{
+  const unsigned int num_categories = 30;
+  const uint32_t all_categories = (1u << num_categories) - 1;
+
+  // two letter names in the same order as qre::general_category
+  const char *category_names[num_categories] =
+    { "Cc", "Cf", "Cn", "Co", "Cs", "Ll", "Lm", "Lo", "Lt", "Lu",
+      "Mc", "Me", "Mn", "Nd", "Nl", "No", "Pc", "Pd", "Pe", "Pf",
+      "Pi", "Po", "Ps", "Sc", "Sk", "Sm", "So", "Zl", "Zp", "Zs" };
+
+  uint32_t category_bits(const std::string &prefix)
+  {
+    uint32_t result = 0;
+    for(unsigned int c = 0; c < num_categories; c++)
+      if(std::string(category_names[c]).compare(0, prefix.length(), prefix) == 0)
+        result |= 1u << c;
+    return result;
+  }
+
+  // "L", "Lu", "LC" ...
+  uint32_t category_mask(const std::u32string &name)
+  {
+    std::string tmp;
+    for(auto &ch : name)
+      if(ch < 0x80)
+        tmp.push_back(ch);
+      else
+        throw std::runtime_error("Unknown Unicode property.");
+
+    uint32_t result = 0;
+    if(tmp == "Any")
+      result = all_categories;
+    else if(tmp == "LC" || tmp == "L&")
+      result = category_bits("Ll") | category_bits("Lt") | category_bits("Lu");
+    else if(tmp.length() == 1 || tmp.length() == 2)
+      result = category_bits(tmp);
+    if(!result)
+      throw std::runtime_error("Unknown Unicode property.");
+    return result;
+  }
+
+  // White_Space property
+  const std::vector<std::pair<char32_t, char32_t>> white_space =
+    { { 0x0009, 0x000D }, { 0x0020, 0x0020 }, { 0x0085, 0x0085 },
+      { 0x00A0, 0x00A0 }, { 0x1680, 0x1680 }, { 0x2000, 0x200A },
+      { 0x2028, 0x2029 }, { 0x202F, 0x202F }, { 0x205F, 0x205F },
+      { 0x3000, 0x3000 } };
+}
+
+qre::charset_t qre::category_charset(uint32_t categories)
+{
+  static std::mutex mutex;
+  static std::vector<charset_t> sets; // one per category
+  static std::map<uint32_t, charset_t> cache;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = cache.find(categories);
+  if(it != cache.end())
+    return it->second;
+
+  if(sets.empty())
+    {
+      sets.resize(num_categories);
+      char32_t begin = 0;
+      general_category cat = category(0);
+      for(char32_t ch = 1; ch <= max_char + 1; ch++)
+        {
+          general_category next = ch <= max_char ? category(ch) : cat;
+          if(next != cat || ch > max_char)
+            {
+              sets[static_cast<unsigned int>(cat)].push_back({ begin, ch - 1 });
+              begin = ch;
+              cat = next;
+            }
+        }
+    }
+
+  charset_t result;
+  for(unsigned int c = 0; c < num_categories; c++)
+    if(categories & (1u << c))
+      result.insert(result.end(), sets[c].begin(), sets[c].end());
+  result = charset_normalise(result);
+  cache[categories] = result;
+  return result;
+}
+
+bool qre::read_property(const std::u32string &str, unsigned int &pos, test_t &test)
+{
+  if(str[pos] != '\\' || pos + 1 >= str.length())
+    return false;
+
+  uint32_t categories = 0;
+  bool neg = false;
+  unsigned int newpos = pos + 2;
+  switch(str[pos+1])
+    {
+    case 'D':
+      neg = true;
+      // fall through
+    case 'd': // decimal digit
+      categories = category_bits("Nd");
+      break;
+
+    case 'W':
+      neg = true;
+      // fall through
+    case 'w': // word character
+      categories = category_bits("L") | category_bits("M")
+        | category_bits("Nd") | category_bits("Pc");
+      break;
+
+    case 'S':
+      neg = true;
+      // fall through
+    case 's': // white space
+      {
+        charset_t space;
+        for(auto &r : white_space)
+          space.push_back({ r.first, r.second });
+        if(neg)
+          space = charset_invert(space);
+        test.ranges.insert(space.begin(), space.end());
+      }
+      pos = newpos;
+      return true;
+
+    case 'P':
+      neg = true;
+      // fall through
+    case 'p': // general category
+      if(newpos < str.length() && str[newpos] == '{')
+        {
+          size_t end = str.find('}', newpos);
+          if(end == std::u32string::npos)
+            throw std::runtime_error("Expected '}'.");
+          std::u32string name = str.substr(newpos + 1, end - newpos - 1);
+          if(name.length() && name[0] == '^')
+            {
+              neg = !neg;
+              name.erase(0, 1);
+            }
+          categories = category_mask(name);
+          newpos = end + 1;
+        }
+      else if(newpos < str.length())
+        categories = category_mask(str.substr(newpos++, 1));
+      else
+        throw std::runtime_error("Missing Unicode property.");
+      break;
+
+    default:
+      return false;
+    }
+
+  if(neg)
+    categories = all_categories & ~categories;
+  test.categories |= categories;
+  pos = newpos;
+  return true;
+}
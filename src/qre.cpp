@@ -23,25 +23,25 @@
 qre::qre()
 {
   // initialise state chain
-  the_chain.begin = std::make_shared<state_t>();
-  the_chain.end = std::make_shared<state_t>();
+  the_chain.begin = new_state();
+  the_chain.end = new_state();
   epsilon(the_chain.begin, the_chain.end);
+  compile();
 }
 
-qre::qre(const std::string &regex)
-  : id(0)
+qre::qre(const std::string &regex, compile_flag flags)
+  : id(0), source(regex)
 {
-  std::list<symbol> syms = tokeniser(utf8toutf32(regex));
+  icase = (flags & compile_flag::icase) != compile_flag::none;
+  jit = (flags & compile_flag::jit) != compile_flag::none;
+  tokens_t tokens = tokeniser(utf8toutf32(regex), icase);
 #ifdef DEBUG
-  std::cerr << "Found " << syms.size() << " tokens" << std::endl;
+  std::cerr << "Found " << tokens.syms.size() << " tokens" << std::endl;
 #endif
-  the_chain = parse_expression(syms);
-
   // TODO: improve error reporting
-  if(!the_chain)
-    throw std::runtime_error("Expected expression.");
-  if(syms.size() > 0)
-    throw std::runtime_error("Unparsed tokens.");
+  the_chain = parse(tokens);
+
+  compile();
 }
 
 qre::qre(const qre &q)
@@ -50,45 +50,202 @@ qre::qre(const qre &q)
 }
 
 qre::qre(qre &&q)
+  : qre()
 {
-  *this = q;
+  // q is left with the empty pattern
+  *this = std::move(q);
 }
 
 qre &qre::operator=(const qre &q)
 {
-  the_chain = clone(q.the_chain);
+  if(this == &q)
+    return *this;
+
+  // links are indices, so the arena can be copied as it is
+  states = q.states;
+  the_chain = q.the_chain;
+  source = q.source;
+  icase = q.icase;
+  jit = q.jit;
+  forced = q.forced;
+
+  // the engines are copied as well, with their pointers into this arena
+  onepass = q.onepass;
+  onepass_eol = q.onepass_eol;
+  for(auto &leaves : onepass)
+    for(auto &leaf : leaves)
+      {
+        // tests belong to the states on the path
+        auto rebase = [this, &leaf] (const test_t *test) -> const test_t*
+          {
+            for(auto s : leaf.path)
+              for(unsigned int c = 0; c < s->transitions.size(); c++)
+                if(&s->transitions[c].test == test)
+                  return &states[s->id].transitions[c].test;
+            return nullptr;
+          };
+        for(auto &a : leaf.asserts)
+          a = rebase(a);
+        if(leaf.test)
+          leaf.test = rebase(leaf.test);
+        for(auto &s : leaf.path)
+          s = &states[s->id];
+      }
+
+  automaton = q.automaton;
+  capturing = q.capturing;
+  for(unsigned int multiline = 0; multiline < 2; multiline++)
+    for(unsigned int utf8 = 0; utf8 < 2; utf8++)
+      {
+        nfa[multiline][utf8] = q.nfa[multiline][utf8];
+        nfa_reverse[multiline][utf8] = q.nfa_reverse[multiline][utf8];
+        dfa_first[multiline][utf8] = q.dfa_first[multiline][utf8];
+        dfa_all[multiline][utf8] = q.dfa_all[multiline][utf8];
+        dfa_reverse[multiline][utf8] = q.dfa_reverse[multiline][utf8];
+      }
+  dfa_attach(true);
+
+  for(unsigned int utf8 = 0; utf8 < 2; utf8++)
+    {
+      prefix[utf8] = q.prefix[utf8];
+      prefix_mask[utf8] = q.prefix_mask[utf8];
+      literal[utf8] = q.literal[utf8];
+    }
+
+  loops = q.loops;
+  for(auto &loop : loops)
+    loop.test = &states[loop.body].transitions[0].test;
+
+  // the machine code refers to nothing outside of it
+  jit_code = q.jit_code;
+  for(unsigned int multiline = 0; multiline < 2; multiline++)
+    for(unsigned int fix_right = 0; fix_right < 2; fix_right++)
+      jit_entry[multiline][fix_right] = q.jit_entry[multiline][fix_right];
+
+  min_length = q.min_length;
+  backreferences = q.backreferences;
+  capture_groups = q.capture_groups;
+  max_length = q.max_length;
   return *this;
 }
 
 qre &qre::operator=(qre &&q)
 {
+  // vectors keep their elements when swapped, so pointers stay valid
+  std::swap(states, q.states);
   std::swap(the_chain, q.the_chain);
+  std::swap(source, q.source);
+  std::swap(icase, q.icase);
+  std::swap(jit, q.jit);
+  std::swap(forced, q.forced);
+
+  std::swap(onepass, q.onepass);
+  std::swap(onepass_eol, q.onepass_eol);
+  std::swap(automaton, q.automaton);
+  std::swap(capturing, q.capturing);
+  std::swap(nfa, q.nfa);
+  std::swap(nfa_reverse, q.nfa_reverse);
+  std::swap(dfa_first, q.dfa_first);
+  std::swap(dfa_all, q.dfa_all);
+  std::swap(dfa_reverse, q.dfa_reverse);
+  dfa_attach(false);
+  q.dfa_attach(false);
+  std::swap(prefix, q.prefix);
+  std::swap(prefix_mask, q.prefix_mask);
+  std::swap(literal, q.literal);
+  std::swap(loops, q.loops);
+  std::swap(jit_code, q.jit_code);
+  std::swap(jit_entry, q.jit_entry);
+  std::swap(min_length, q.min_length);
+  std::swap(backreferences, q.backreferences);
+  std::swap(capture_groups, q.capture_groups);
+  std::swap(max_length, q.max_length);
   return *this;
 }
 
 qre::~qre()
 {
-  // already visited states
-  std::set<std::shared_ptr<state_t>> states;
+  // the arena goes at once
+}
 
-  std::function<void(std::shared_ptr<state_t> state)> clear
-    = [&clear, &states] (std::shared_ptr<state_t> state)
+void qre::compile()
+{
+  if(!the_chain)
     {
-      // state already visited?
-      auto it = states.find(state);
-      if(it != states.end())
-        return;
+      // nothing to match, like an object moved from
+      states.clear();
+      onepass.clear();
+      onepass_eol = false;
+      automaton = capturing = false;
+      for(unsigned int multiline = 0; multiline < 2; multiline++)
+        for(unsigned int utf8 = 0; utf8 < 2; utf8++)
+          {
+            nfa[multiline][utf8] = nfa_t();
+            nfa_reverse[multiline][utf8] = nfa_t();
+            dfa_first[multiline][utf8].reset();
+            dfa_all[multiline][utf8].reset();
+            dfa_reverse[multiline][utf8].reset();
+          }
+      for(unsigned int utf8 = 0; utf8 < 2; utf8++)
+        {
+          prefix[utf8].clear();
+          prefix_mask[utf8].clear();
+          literal[utf8] = false;
+        }
+      loops.clear();
+      jit_code.reset();
+      for(auto &modes : jit_entry)
+        modes[0] = modes[1] = nullptr;
+      min_length = 0;
+      backreferences = false;
+      capture_groups.clear();
+      max_length.clear();
+      return;
+    }
 
-      // collect
-      states.insert(state);
-      for(auto &t : state->transitions)
-        clear(t.state);
+  // number all reachable states in depth-first order
+  std::vector<unsigned int> order;
+  std::vector<unsigned int> number(states.size(), no_state);
+  std::stack<unsigned int> todo;
+  todo.push(the_chain.begin);
+  while(todo.size())
+    {
+      unsigned int state = todo.top();
+      todo.pop();
+      if(number[state] != no_state)
+        continue;
 
-      // clear
-      state->transitions.clear();
-    };
+      number[state] = order.size();
+      order.push_back(state);
+      for(auto &t : states[state].transitions)
+        todo.push(t.state);
+    }
+  if(number[the_chain.end] == no_state)
+    {
+      number[the_chain.end] = order.size();
+      order.push_back(the_chain.end);
+    }
 
-  clear(the_chain.begin);
+  // keep only those in the arena
+  std::vector<state_t> reachable(order.size());
+  for(unsigned int c = 0; c < order.size(); c++)
+    {
+      std::swap(reachable[c], states[order[c]]);
+      reachable[c].id = c;
+      for(auto &t : reachable[c].transitions)
+        t.state = number[t.state];
+    }
+  states.swap(reachable);
+  the_chain.begin = number[the_chain.begin];
+  the_chain.end = number[the_chain.end];
+
+  onepass_compile();
+  nfa_compile();
+  longest_compile();
+  prefilter_compile();
+  loop_compile();
+  engine_compile();
+  jit_compile();
 }
 
 qre::match_flag operator|(const qre::match_flag &f1, const qre::match_flag &f2)
@@ -102,3 +259,20 @@ qre::match_flag operator&(const qre::match_flag &f1, const qre::match_flag &f2)
   return static_cast<qre::match_flag>(static_cast<uint8_t>(f1)
                                       & static_cast<uint8_t>(f2));
 }
+
+qre::match_flag operator~(const qre::match_flag &f)
+{
+  return static_cast<qre::match_flag>(~static_cast<uint8_t>(f));
+}
+
+qre::compile_flag operator|(const qre::compile_flag &f1, const qre::compile_flag &f2)
+{
+  return static_cast<qre::compile_flag>(static_cast<uint8_t>(f1)
+                                        | static_cast<uint8_t>(f2));
+}
+
+qre::compile_flag operator&(const qre::compile_flag &f1, const qre::compile_flag &f2)
+{
+  return static_cast<qre::compile_flag>(static_cast<uint8_t>(f1)
+                                        & static_cast<uint8_t>(f2));
+}
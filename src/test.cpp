@@ -37,27 +37,39 @@ bool qre::char_range::operator<(const char_range &r) const
     return false;
 }
 
-bool qre::check(const test_t &test, const std::string &str,
-                unsigned int &pos, bool multiline, bool utf8,
+bool qre::check(const test_t &test, const text &str,
+                size_t &pos, bool multiline, bool utf8,
                 match &match_sofar) const
 {
   bool result = false;
-  unsigned int newpos = pos;
+  size_t newpos = pos;
   char32_t tmp;
 
-  auto advance = qre::advance;
-  auto peek = qre::peek;
-  auto peek_prev = qre::peek_prev;
-
-  if(!utf8)
+  // ASCII characters are decoded inline
+  auto advance = [utf8] (const text &str, size_t &pos) -> char32_t
     {
-      advance = [] (const std::string &str, unsigned int &pos) -> char32_t
-        { return static_cast<char32_t>(str[pos++]) & 0xFF; };
-      peek = [] (const std::string &str, unsigned int pos) -> char32_t
-        { return static_cast<char32_t>(str[pos]) & 0xFF; };
-      peek_prev = [] (const std::string &str, unsigned int pos) -> char32_t
-        { return static_cast<char32_t>(str[pos-1]) & 0xFF; };
-    }
+      uint8_t ch = str[pos];
+      if(!utf8 || ch < 0x80)
+        {
+          pos++;
+          return ch;
+        }
+      return qre::advance(str, pos);
+    };
+  auto peek = [utf8] (const text &str, size_t pos) -> char32_t
+    {
+      uint8_t ch = str[pos];
+      if(!utf8 || ch < 0x80)
+        return ch;
+      return qre::peek(str, pos);
+    };
+  auto peek_prev = [utf8] (const text &str, size_t pos) -> char32_t
+    {
+      uint8_t ch = str[pos-1];
+      if(!utf8 || ch < 0x80)
+        return ch;
+      return qre::peek_prev(str, pos);
+    };
 
   switch(test.type)
     {
@@ -195,13 +207,17 @@ bool qre::check(const test_t &test, const std::string &str,
       std::cerr << std::endl;
 #endif
 
+      // general categories
+      if(test.categories & (1u << static_cast<unsigned int>(category(tmp))))
+        result = true;
+
       // negation
       result = result != test.neg;
 
       // subtraction
       for(auto &sub : test.subtractions)
         {
-          unsigned int oldpos = pos;
+          size_t oldpos = pos;
           if(result && check(sub, str, pos, multiline, utf8, match_sofar))
             {
               pos = oldpos;
@@ -213,7 +229,7 @@ bool qre::check(const test_t &test, const std::string &str,
       // intersection
       for(auto &itr : test.intersections)
         {
-          unsigned int oldpos = pos;
+          size_t oldpos = pos;
           if(result && !check(itr, str, pos, multiline, utf8, match_sofar))
             {
               result = false;
@@ -265,18 +281,32 @@ bool qre::check(const test_t &test, const std::string &str,
           if(brp2 >= brp->size())
             return false;
 
-          std::string br = brp->at(brp2);
+          const std::string &br = brp->at(brp2);
 #ifdef DEBUG
           std::cerr << br << " == " << str.substr(pos, br.length()) << std::endl;
 #endif
-          // raw string comparison
-          if(br == str.substr(pos, br.length()))
+          // raw comparison, in place since the input may be segmented
+          if(!test.icase)
             {
+              if(pos + br.length() > str.length())
+                return false;
+              for(size_t c = 0; c < br.length(); c++)
+                if(str[pos+c] != br[c])
+                  return false;
               pos += br.length();
               return true;
             }
-          else
-            return false;
+
+          // compare characters ignoring case
+          size_t brpos = 0;
+          while(brpos < br.length())
+            {
+              if(newpos >= str.length()
+                 || fold(advance(br, brpos)) != fold(advance(str, newpos)))
+                return false;
+            }
+          pos = newpos;
+          return true;
         }
       break;
 
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2016 Nils Christopher Brause
+ *
+ * This file is part of libqre.
+ *
+ * libqre is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libqre is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libqre.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <qre.hpp>
+
+qre::text::text(const segment *segs, size_t count)
+  : ptr(nullptr), len(0)
+{
+  // empty segments are never read
+  for(size_t c = 0; c < count; c++)
+    if(segs[c].length)
+      {
+        segments.push_back({len, segs[c]});
+        len += segs[c].length;
+      }
+
+  // a single piece is read like a string
+  if(segments.size() <= 1)
+    {
+      if(segments.size())
+        ptr = segments.front().second.data;
+      segments.clear();
+    }
+  window = segments.size() ? segments.front().second.data : ptr;
+  window_begin = 0;
+  window_length = segments.size() ? segments.front().second.length : len;
+}
+
+char qre::text::locate(size_t pos) const
+{
+  if(pos >= len)
+    return '\0';
+
+  // last segment that begins at or before pos
+  auto it = std::upper_bound(segments.begin(), segments.end(), pos,
+                             [] (size_t pos, const std::pair<size_t, segment> &seg)
+                             { return pos < seg.first; }) - 1;
+  window = it->second.data;
+  window_begin = it->first;
+  window_length = it->second.length;
+  return window[pos - window_begin];
+}
+
+void qre::text::append_to(std::string &out, size_t pos, size_t n) const
+{
+  n = std::min(n, len - pos);
+  if(contiguous())
+    {
+      out.append(ptr + pos, n);
+      return;
+    }
+
+  while(n)
+    {
+      locate(pos);
+      size_t piece = std::min(n, window_begin + window_length - pos);
+      out.append(window + (pos - window_begin), piece);
+      pos += piece;
+      n -= piece;
+    }
+}
+
+std::string qre::text::substr(size_t pos, size_t n) const
+{
+  std::string result;
+  append_to(result, pos, n);
+  return result;
+}
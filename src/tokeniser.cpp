@@ -207,6 +207,15 @@ char32_t read_escape(const std::u32string &str, unsigned int &pos)
   return ch;
 }
 
+// compares without copying the pattern
+static bool looking_at(const std::u32string &str, unsigned int pos, const char *s)
+{
+  for(; *s; s++, pos++)
+    if(pos >= str.length() || str[pos] != static_cast<char32_t>(*s))
+      return false;
+  return true;
+}
+
 qre::test_t qre::read_char_class(const std::u32string &str, unsigned int &pos, bool leading_backet) const
 {
   if(leading_backet)
@@ -228,24 +237,27 @@ qre::test_t qre::read_char_class(const std::u32string &str, unsigned int &pos, b
   while(pos < str.length() && str[pos] != ']')
     {
       // character class subtraction
-      if(str.substr(pos, 2) == U"-[")
+      if(looking_at(str, pos, "-["))
         {
           pos++;
           test.subtractions.push_back(read_char_class(str, pos));
         }
       // character class intersection
-      else if(str.substr(pos, 3) == U"&&[")
+      else if(looking_at(str, pos, "&&["))
         {
           pos += 2;
           test.intersections.push_back(read_char_class(str, pos));
         }
       // character class intersection without brackets
-      else if(str.substr(pos, 2) == U"&&")
+      else if(looking_at(str, pos, "&&"))
         {
           pos += 2;
           test.intersections.push_back(read_char_class(str, pos, false));
           return test; // closing bracket already read
         }
+      // predefined classes and Unicode properties
+      else if(read_property(str, pos, test))
+        continue;
       else
         {
           // read character
@@ -431,7 +443,7 @@ std::pair<qre::capture_t, signed int> qre::read_backref(const std::u32string &st
   return result;
 }
 
-std::u32string qre::read_cg_name(const std::u32string str, unsigned int &pos) const
+std::u32string qre::read_cg_name(const std::u32string &str, unsigned int &pos) const
 {
   char32_t paran;
   switch(str[pos++])
@@ -464,9 +476,20 @@ std::u32string qre::read_cg_name(const std::u32string str, unsigned int &pos) co
   return result;
 }
 
-std::list<qre::symbol> qre::tokeniser(const std::u32string &str) const
+qre::tokens_t qre::tokeniser(const std::u32string &str, bool icase) const
 {
-  std::list<symbol> syms;
+  tokens_t tokens;
+  std::vector<symbol> &syms = tokens.syms;
+  syms.reserve(str.length());
+  // adds a test to the pool
+  auto add_test = [&tokens] (symbol &sym) -> test_t&
+    {
+      sym.type = symbol::type_t::test;
+      sym.test = tokens.tests.size();
+      tokens.tests.emplace_back();
+      return tokens.tests.back();
+    };
+  std::vector<bool> icase_stack; // case sensitivity outside of groups
   unsigned int pos = 0;
   while(pos < str.length())
     {
@@ -474,11 +497,37 @@ std::list<qre::symbol> qre::tokeniser(const std::u32string &str) const
       if(str[pos] == '(')
         {
           sym.type = symbol::type_t::lparan;
+          icase_stack.push_back(icase);
           pos++;
           if(str[pos] == '?')
             {
               switch(str[pos+1])
                 {
+                case 'i':
+                case '-':
+                  {
+                    // inline options: "(?i)", "(?-i)", "(?i:...)", "(?-i:...)"
+                    bool on = str[pos+1] != '-';
+                    unsigned int len = on ? 2 : 3;
+                    if(str[pos+len-1] != 'i')
+                      throw std::runtime_error("Unsupported inline option.");
+                    icase = on;
+                    if(str[pos+len] == ')')
+                      {
+                        // applies to the rest of the enclosing group
+                        icase_stack.pop_back();
+                        pos += len+1;
+                        continue; // discard 'sym'
+                      }
+                    else if(str[pos+len] == ':')
+                      {
+                        sym.capture = false;
+                        pos += len+1;
+                      }
+                    else
+                      throw std::runtime_error("Unsupported inline option.");
+                  }
+                  break;
                 case ':':
                   sym.capture = false;
                   pos += 2;
@@ -493,7 +542,8 @@ std::list<qre::symbol> qre::tokeniser(const std::u32string &str) const
                   sym.capture = true;
                   sym.named = true;
                   pos++;
-                  sym.name = utf32toutf8(read_cg_name(str, pos));
+                  sym.name = tokens.names.size();
+                  tokens.names.push_back(utf32toutf8(read_cg_name(str, pos)));
                   break;
                 default:
                   throw std::runtime_error("Unsupported group.");
@@ -507,6 +557,11 @@ std::list<qre::symbol> qre::tokeniser(const std::u32string &str) const
         {
           sym.type = symbol::type_t::rparan;
           pos++;
+          if(icase_stack.size())
+            {
+              icase = icase_stack.back();
+              icase_stack.pop_back();
+            }
         }
       else if(str[pos] == '|')
         {
@@ -515,8 +570,7 @@ std::list<qre::symbol> qre::tokeniser(const std::u32string &str) const
         }
       else if(str[pos] == '.')
         {
-          sym.type = symbol::type_t::test;
-          sym.test.type = test_t::test_type::any;
+          add_test(sym).type = test_t::test_type::any;
           pos++;
         }
      else  if(str[pos] == '?')
@@ -536,14 +590,12 @@ std::list<qre::symbol> qre::tokeniser(const std::u32string &str) const
         }
       else if(str[pos] == '^')
         {
-          sym.type = symbol::type_t::test;
-          sym.test.type = test_t::test_type::bol;
+          add_test(sym).type = test_t::test_type::bol;
           pos++;
         }
       else if(str[pos] == '$')
         {
-          sym.type = symbol::type_t::test;
-          sym.test.type = test_t::test_type::eol;
+          add_test(sym).type = test_t::test_type::eol;
           pos++;
         }
       else if(str[pos] == '{')
@@ -553,15 +605,13 @@ std::list<qre::symbol> qre::tokeniser(const std::u32string &str) const
           else
             {
               sym.type = symbol::type_t::test;
-              sym.test.type = test_t::test_type::character;
-              sym.test.chars.insert(str[pos]);
+              sym.ch = str[pos];
               pos++;
             }
         }
       else if(str[pos] == '[')
         {
-          sym.type = symbol::type_t::test;
-          sym.test = read_char_class(str, pos);
+          add_test(sym) = read_char_class(str, pos);
         }
       else if(str[pos] == ']')
         throw std::runtime_error("misplaceed paranthesis");
@@ -573,20 +623,21 @@ std::list<qre::symbol> qre::tokeniser(const std::u32string &str) const
               {
               case '`':
               case 'A':
-                sym.type = symbol::type_t::test;
-                sym.test.type = test_t::test_type::bol;
+                add_test(sym).type = test_t::test_type::bol;
                 break;
               case 'N': // No Newline
-                sym.type = symbol::type_t::test;
-                sym.test.type = test_t::test_type::newline;
-                sym.test.neg = true;
+                {
+                  test_t &test = add_test(sym);
+                  test.type = test_t::test_type::newline;
+                  test.neg = true;
+                }
                 break;
               case 'Q': // Literal sequence
                 while(true)
                   {
                     if(pos == str.size())
                       throw std::runtime_error("Unterminated escape sequence.");
-                    if(str.substr(pos, 2) == U"\\E")
+                    if(looking_at(str, pos, "\\E"))
                       {
                         pos += 2;
                         break;
@@ -595,33 +646,35 @@ std::list<qre::symbol> qre::tokeniser(const std::u32string &str) const
                       {
                         symbol sym2;
                         sym2.type = symbol::type_t::test;
-                        sym2.test.type = test_t::test_type::character;
-                        sym2.test.chars.insert(str[pos++]);
+                        sym2.ch = str[pos++];
+                        sym2.icase = icase;
                         syms.push_back(sym2);
                       }
                   }
                 continue; // discard 'sym'
                 break;
               case 'R': // New line
-                sym.type = symbol::type_t::test;
-                sym.test.type = test_t::test_type::newline;
+                add_test(sym).type = test_t::test_type::newline;
                 break;
               case '\'':
               case 'Z':
-                sym.type = symbol::type_t::test;
-                sym.test.type = test_t::test_type::eol;
+                add_test(sym).type = test_t::test_type::eol;
                 break;
               case 'g':
               case 'k':
-                sym.type = symbol::type_t::test;
-                sym.test.type = test_t::test_type::backref;
-                sym.test.backref = read_backref(str, pos);
+                {
+                  test_t &test = add_test(sym);
+                  test.type = test_t::test_type::backref;
+                  test.backref = read_backref(str, pos);
+                }
                 break;
               case '-':
-                sym.type = symbol::type_t::test;
-                sym.test.type = test_t::test_type::backref;
                 if('1' <= str[pos] && str[pos] <= '9')
-                  sym.test.backref = { { false, -1*(static_cast<signed int>(str[pos++]-'0')), "" }, -1 };
+                  {
+                    test_t &test = add_test(sym);
+                    test.type = test_t::test_type::backref;
+                    test.backref = { { false, -1*(static_cast<signed int>(str[pos++]-'0')), "" }, -1 };
+                  }
                 else
                   throw std::runtime_error("Invalid negative backreference number.");
                 break;
@@ -634,26 +687,54 @@ std::list<qre::symbol> qre::tokeniser(const std::u32string &str) const
               case '7':
               case '8':
               case '9':
-                sym.type = symbol::type_t::test;
-                sym.test.type = test_t::test_type::backref;
-                sym.test.backref = { { false, static_cast<signed int>(str[pos-1]-'0'), "" }, -1 };
+                {
+                  test_t &test = add_test(sym);
+                  test.type = test_t::test_type::backref;
+                  test.backref = { { false, static_cast<signed int>(str[pos-1]-'0'), "" }, -1 };
+                }
                 break;
               default:
                 pos = oldpos;
                 sym.type = symbol::type_t::test;
-                sym.test.type = test_t::test_type::character;
-                sym.test.chars.insert(read_escape(str, pos));
+                {
+                  test_t test;
+                  test.type = test_t::test_type::character;
+                  if(read_property(str, pos, test))
+                    add_test(sym) = std::move(test);
+                  else
+                    sym.ch = read_escape(str, pos);
+                }
               }
           }
       else
         {
           sym.type = symbol::type_t::test;
-          sym.test.type = test_t::test_type::character;
-          sym.test.chars.insert(str[pos]);
+          sym.ch = str[pos];
           pos++;
         }
+
+      // case is ignored by adding the other cases to the tests
+      if(icase && sym.type == symbol::type_t::test)
+        {
+          if(sym.test != no_test)
+            fold_test(tokens.tests[sym.test]);
+          else
+            sym.icase = true;
+        }
       syms.push_back(sym);
     }
 
-  return syms;
+  return tokens;
+}
+
+qre::test_t qre::symbol_test(const tokens_t &tokens, const symbol &sym)
+{
+  if(sym.test != no_test)
+    return tokens.tests[sym.test];
+  test_t test;
+  test.type = test_t::test_type::character;
+  test.chars.insert(sym.ch);
+  if(sym.icase)
+    fold_test(test);
+  return test;
 }
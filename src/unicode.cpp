@@ -1,98 +1,296 @@
 #include <qre.hpp>
 
-char32_t qre::advance(const std::string &str, unsigned int &pos)
-{
-  char32_t result;
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define QRE_X86
+#include <tmmintrin.h>
+#endif
 
-  // EOF
-  if(pos >= str.length())
-    return 0;
-  // ASCII
-  else if((static_cast<uint8_t>(str[pos]) & 0x80) == 0)
-    result = static_cast<uint8_t>(str[pos++]);
-  // UTF-8
-  else
+// scalar validation of UTF-8 (RFC 3629)
+static bool validate_scalar(const uint8_t *str, size_t len, bool &ascii)
+{
+  size_t pos = 0;
+  while(pos < len)
     {
-      unsigned int old = pos;
-      unsigned int tail;
-      // two byte sequence
-      if((static_cast<uint8_t>(str[pos]) & 0xC0) == 0xC0
-         && (static_cast<uint8_t>(str[pos]) & 0x20) == 0)
+      // ASCII
+      if(str[pos] < 0x80)
         {
-          result = static_cast<uint8_t>(str[pos++]) & 0x1F;
-          tail = 1;
+          pos++;
+          continue;
         }
-      // three byte sequence
-      else if((static_cast<uint8_t>(str[pos]) & 0xE0) == 0xE0
-              && (static_cast<uint8_t>(str[pos]) & 0x10) == 0)
+
+      ascii = false;
+      uint8_t ch = str[pos];
+      unsigned int tail;
+      uint8_t min = 0x80; // range of the second byte
+      uint8_t max = 0xBF;
+      if(ch < 0xC2)
+        return false; // continuation byte or overlong
+      else if(ch < 0xE0)
+        tail = 1;
+      else if(ch < 0xF0)
         {
-          result = static_cast<uint8_t>(str[pos++]) & 0x0F;
           tail = 2;
+          if(ch == 0xE0)
+            min = 0xA0; // overlong
+          else if(ch == 0xED)
+            max = 0x9F; // surrogates
         }
-      // four byte sequence
-      else if((static_cast<uint8_t>(str[pos]) & 0xF0) == 0xF0
-              && (static_cast<uint8_t>(str[pos]) & 0x08) == 0)
+      else if(ch < 0xF5)
         {
-          result = static_cast<uint8_t>(str[pos++]) & 0x07;
           tail = 3;
+          if(ch == 0xF0)
+            min = 0x90; // overlong
+          else if(ch == 0xF4)
+            max = 0x8F; // beyond U+10FFFF
         }
       else
-        throw std::runtime_error("Invalid UTF-8");
+        return false;
+
+      if(pos + tail >= len)
+        return false; // truncated sequence
+      if(str[pos+1] < min || str[pos+1] > max)
+        return false;
+      for(unsigned int c = 2; c <= tail; c++)
+        if((str[pos+c] & 0xC0) != 0x80)
+          return false;
+      pos += tail + 1;
+    }
+  return true;
+}
 
-      for(unsigned int c = 0; c < tail; c++)
+#ifdef QRE_X86
+// vectorised validation of UTF-8 after Keiser and Lemire, "Validating UTF-8
+// In Less Than One Instruction Per Byte" (2021): the high and low nibbles of
+// each byte and its predecessor index three tables of error classes whose
+// intersection is non-zero for invalid sequences
+__attribute__((target("ssse3")))
+static bool validate_ssse3(const uint8_t *str, size_t len, bool &ascii)
+{
+  const uint8_t too_short = 1 << 0; // lead byte not followed by continuation
+  const uint8_t too_long = 1 << 1; // continuation without lead byte
+  const uint8_t overlong_3 = 1 << 2;
+  const uint8_t too_large = 1 << 3;
+  const uint8_t surrogate = 1 << 4;
+  const uint8_t overlong_2 = 1 << 5;
+  const uint8_t too_large_1000 = 1 << 6;
+  const uint8_t overlong_4 = 1 << 6;
+  const uint8_t two_conts = 1 << 7;
+  const uint8_t carry = too_short | too_long | two_conts;
+
+  const __m128i byte_1_high_table = _mm_setr_epi8(
+    too_long, too_long, too_long, too_long,
+    too_long, too_long, too_long, too_long,
+    two_conts, two_conts, two_conts, two_conts,
+    too_short | overlong_2,
+    too_short,
+    too_short | overlong_3 | surrogate,
+    too_short | too_large | too_large_1000 | overlong_4);
+  const __m128i byte_1_low_table = _mm_setr_epi8(
+    carry | overlong_3 | overlong_2 | overlong_4,
+    carry | overlong_2,
+    carry,
+    carry,
+    carry | too_large,
+    carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000 | surrogate,
+    carry | too_large | too_large_1000,
+    carry | too_large | too_large_1000);
+  const __m128i byte_2_high_table = _mm_setr_epi8(
+    too_short, too_short, too_short, too_short,
+    too_short, too_short, too_short, too_short,
+    too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4,
+    too_long | overlong_2 | two_conts | overlong_3 | too_large,
+    too_long | overlong_2 | two_conts | surrogate | too_large,
+    too_long | overlong_2 | two_conts | surrogate | too_large,
+    too_short, too_short, too_short, too_short);
+  // bytes that leave a sequence incomplete at the end of a block
+  const __m128i max_value = _mm_setr_epi8(
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    0xEF, 0xDF, 0xBF);
+  const __m128i nibble = _mm_set1_epi8(0x0F);
+
+  __m128i error = _mm_setzero_si128();
+  __m128i prev_input = _mm_setzero_si128();
+  __m128i prev_incomplete = _mm_setzero_si128();
+  for(size_t pos = 0; pos < len; pos += 16)
+    {
+      __m128i input;
+      if(pos + 16 <= len)
+        input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + pos));
+      else
         {
-          if(pos >= str.length())
-            {
-              pos = old;
-              return 0;
-            }
-          else if((static_cast<uint8_t>(str[pos]) & 0x80) == 0x80
-             && (static_cast<uint8_t>(str[pos]) & 0x40) == 0)
-            {
-              result <<= 6;
-              result |= static_cast<uint8_t>(str[pos++]) & 0x3F;
-            }
-          else
-            throw std::runtime_error("Invalid UTF-8");
+          // pad the last block with ASCII
+          uint8_t tmp[16] = { 0 };
+          for(size_t c = 0; pos + c < len; c++)
+            tmp[c] = str[pos+c];
+          input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(tmp));
+        }
+
+      // ASCII block
+      if(_mm_movemask_epi8(input) == 0)
+        {
+          error = _mm_or_si128(error, prev_incomplete);
+          prev_incomplete = _mm_setzero_si128();
+          prev_input = input;
+          continue;
         }
+      ascii = false;
+
+      __m128i prev1 = _mm_alignr_epi8(input, prev_input, 16-1);
+      __m128i byte_1_high = _mm_shuffle_epi8(byte_1_high_table,
+                                             _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+      __m128i byte_1_low = _mm_shuffle_epi8(byte_1_low_table,
+                                            _mm_and_si128(prev1, nibble));
+      __m128i byte_2_high = _mm_shuffle_epi8(byte_2_high_table,
+                                             _mm_and_si128(_mm_srli_epi16(input, 4), nibble));
+      __m128i special = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+      // third and fourth bytes of a sequence must be continuations
+      __m128i prev2 = _mm_alignr_epi8(input, prev_input, 16-2);
+      __m128i prev3 = _mm_alignr_epi8(input, prev_input, 16-3);
+      __m128i third = _mm_subs_epu8(prev2, _mm_set1_epi8(0xE0-0x80));
+      __m128i fourth = _mm_subs_epu8(prev3, _mm_set1_epi8(0xF0-0x80));
+      __m128i must23 = _mm_and_si128(_mm_or_si128(third, fourth), _mm_set1_epi8(0x80));
+      error = _mm_or_si128(error, _mm_xor_si128(must23, special));
+
+      prev_incomplete = _mm_subs_epu8(input, max_value);
+      prev_input = input;
     }
+  error = _mm_or_si128(error, prev_incomplete);
 
-  return result;
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xFFFF;
 }
+#endif
 
-char32_t qre::peek(const std::string &str, unsigned int pos)
+// validates a contiguous piece
+static bool validate(const uint8_t *data, size_t len, bool &ascii)
 {
-  return advance(str, pos);
+#ifdef QRE_X86
+  static const bool ssse3 = __builtin_cpu_supports("ssse3");
+  if(ssse3)
+    return validate_ssse3(data, len, ascii);
+#endif
+  return validate_scalar(data, len, ascii);
 }
 
-char32_t qre::peek_prev(const std::string &str, unsigned int pos)
+qre::utf8_status qre::validate_utf8(const text &str)
 {
-  unsigned int old = pos;
-  while(true)
+  bool ascii = true;
+  bool valid = true;
+  if(str.contiguous())
+    valid = validate(reinterpret_cast<const uint8_t*>(str.data()), str.length(), ascii);
+  else
     {
-      if(pos == 0)
+      // segments are validated in place up to a sequence that continues in
+      // the next one, which is copied
+      size_t pos = 0;
+      for(auto &seg : str.segments)
         {
-          pos = old;
-          return 0;
+          const uint8_t *data = reinterpret_cast<const uint8_t*>(seg.second.data);
+          size_t begin = pos - seg.first;
+          size_t end = seg.second.length;
+          if(!valid || pos >= seg.first + end)
+            continue;
+
+          // sequence cut off at the end
+          size_t tail = 0;
+          for(size_t c = 1; c <= 3 && c <= end - begin; c++)
+            if((data[end-c] & 0xC0) != 0x80)
+              {
+                uint8_t ch = data[end-c];
+                size_t length = ch < 0xC0 ? 1 : ch < 0xE0 ? 2 : ch < 0xF0 ? 3 : 4;
+                if(length > c)
+                  tail = std::min(length, str.length() - (seg.first + end - c));
+                end -= length > c ? c : 0;
+                break;
+              }
+
+          valid = validate(data + begin, end - begin, ascii);
+          pos = seg.first + end;
+          if(tail)
+            {
+              uint8_t sequence[4];
+              for(size_t c = 0; c < tail; c++)
+                sequence[c] = str[pos+c];
+              valid = valid && validate_scalar(sequence, tail, ascii);
+              pos += tail;
+            }
         }
-      else
-        pos--;
+    }
 
-      if((static_cast<uint8_t>(str[pos]) & 0x80) == 0x80
-              && (static_cast<uint8_t>(str[pos]) & 0x40) == 0)
-        continue;
-      else
-        return advance(str, pos);
+  if(!valid)
+    return utf8_status::invalid;
+  return ascii ? utf8_status::ascii : utf8_status::valid;
+}
+
+char32_t qre::advance(const text &str, size_t &pos)
+{
+  // EOF
+  if(pos >= str.length())
+    return 0;
+
+  // input has been validated before
+  uint8_t ch[4] = { static_cast<uint8_t>(str[pos]) };
+  if(ch[0] < 0x80)
+    {
+      pos += 1;
+      return ch[0];
+    }
+  // the sequence may continue in the next segment
+  for(unsigned int c = 1; c < 4; c++)
+    ch[c] = str[pos+c];
+  if(ch[0] < 0xE0)
+    {
+      pos += 2;
+      return (ch[0] & 0x1F) << 6 | (ch[1] & 0x3F);
+    }
+  else if(ch[0] < 0xF0)
+    {
+      pos += 3;
+      return (ch[0] & 0x0F) << 12 | (ch[1] & 0x3F) << 6 | (ch[2] & 0x3F);
+    }
+  else
+    {
+      pos += 4;
+      return (ch[0] & 0x07) << 18 | (ch[1] & 0x3F) << 12
+        | (ch[2] & 0x3F) << 6 | (ch[3] & 0x3F);
     }
 }
 
+char32_t qre::peek(const text &str, size_t pos)
+{
+  return advance(str, pos);
+}
+
+char32_t qre::peek_prev(const text &str, size_t pos)
+{
+  if(pos == 0)
+    return 0;
+
+  // skip at most three continuation bytes
+  size_t begin = pos - 1;
+  while(begin > 0 && pos - begin < 4
+        && (static_cast<uint8_t>(str[begin]) & 0xC0) == 0x80)
+    begin--;
+  return advance(str, begin);
+}
+
 std::u32string qre::utf8toutf32(const std::string &str) const
 {
-  unsigned int pos = 0;
-  char32_t tmp;
+  if(validate_utf8(str) == utf8_status::invalid)
+    throw std::runtime_error("Invalid UTF-8");
+
+  size_t pos = 0;
   std::u32string result;
-  while((tmp = qre::advance(str, pos)) != 0)
-    result.push_back(tmp);
+  while(pos < str.length())
+    result.push_back(qre::advance(str, pos));
   return result;
 }
 
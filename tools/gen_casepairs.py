@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+#
+# Copyright 2016 Nils Christopher Brause
+#
+# This file is part of libqre.
+#
+# libqre is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# libqre is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with libqre.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+# Generates src/casepairs.cpp, the pairs of characters that are equal when
+# ignoring case, from the simple case foldings (status C and S) of
+# CaseFolding.txt in the Unicode character database:
+#
+#   python3 tools/gen_casepairs.py CaseFolding.txt > src/casepairs.cpp
+#
+# Every folding joins a character and its folded form. Pairs with the same
+# distance and consecutive first characters become one range, pairs of
+# neighbours that alternate like "AaBb" become one range with distance 0.
+
+import re
+import sys
+
+
+def read_pairs(path):
+    """returns the Unicode version and the (lower, higher) pairs"""
+    version = "unknown"
+    pairs = set()
+    for line in open(path, encoding="utf-8"):
+        match = re.match(r"#\s*CaseFolding-(\S+)\.txt", line)
+        if match:
+            version = match.group(1)
+        fields = [f.strip() for f in line.split("#")[0].split(";")]
+        if len(fields) < 3 or fields[1] not in ("C", "S"):
+            continue
+        a, b = int(fields[0], 16), int(fields[2], 16)
+        pairs.add((min(a, b), max(a, b)))
+    return version, sorted(pairs)
+
+
+def ranges(pairs):
+    """merges pairs into (begin, end, delta) ranges"""
+    result = []
+    c = 0
+    while c < len(pairs):
+        low, high = pairs[c]
+        delta = high - low
+        n = 1
+        if delta == 1:
+            # alternating neighbours
+            while (c + n < len(pairs)
+                   and pairs[c+n] == (low + 2*n, low + 2*n + 1)):
+                n += 1
+        if n > 1:
+            result.append((low, low + 2*n - 1, 0))
+        else:
+            while (c + n < len(pairs)
+                   and pairs[c+n] == (low + n, low + n + delta)):
+                n += 1
+            result.append((low, low + n - 1, delta))
+        c += n
+    return result
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.stderr.write("usage: %s CaseFolding.txt\n" % sys.argv[0])
+        sys.exit(2)
+    version, pairs = read_pairs(sys.argv[1])
+    table = ranges(pairs)
+
+    license = open(__file__).read().split("\n\n")[0].split("\n")[2:]
+    out = sys.stdout
+    out.write("/*\n")
+    for line in license:
+        out.write((" * " + line[2:]).rstrip() + "\n" if line != "#" else " *\n")
+    out.write(" */\n\n")
+    out.write("// generated by tools/gen_casepairs.py from Unicode %s\n\n"
+              % version)
+    out.write("#include <qre.hpp>\n\n")
+    out.write("const qre::case_pairs_t qre::case_pairs[] =\n  {\n")
+    for c in range(0, len(table), 3):
+        out.write("    " + " ".join("{ 0x%05X, 0x%05X, %5d }," % r
+                                    for r in table[c:c+3]) + "\n")
+    out.write("  };\n\n")
+    out.write("const unsigned int qre::num_case_pairs = %d;\n" % len(table))
+
+
+main()
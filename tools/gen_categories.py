@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+#
+# Copyright 2016 Nils Christopher Brause
+#
+# This file is part of libqre.
+#
+# libqre is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# libqre is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with libqre.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+# Generates src/categories.cpp, the table of Unicode general categories,
+# from the character database that ships with Python:
+#
+#   python3 tools/gen_categories.py > src/categories.cpp
+#
+# The category of a code point is found in three steps. The upper bits
+# select a group of blocks, the middle bits a block within the group and the
+# lower bits the category within the block. Equal groups and blocks are
+# stored only once.
+
+import sys
+import unicodedata
+
+MAX_CHAR = 0x10FFFF
+BLOCK = 32 # code points per block
+GROUP = 32 # blocks per group
+
+# same order as qre::general_category
+CATEGORIES = ["Cc", "Cf", "Cn", "Co", "Cs", "Ll", "Lm", "Lo", "Lt", "Lu",
+              "Mc", "Me", "Mn", "Nd", "Nl", "No", "Pc", "Pd", "Pe", "Pf",
+              "Pi", "Po", "Ps", "Sc", "Sk", "Sm", "So", "Zl", "Zp", "Zs"]
+
+
+def dedup(items, size):
+    """splits items into chunks of size and returns unique chunks and indices"""
+    chunks = {}
+    indices = []
+    for i in range(0, len(items), size):
+        key = tuple(items[i:i+size])
+        indices.append(chunks.setdefault(key, len(chunks)))
+    unique = [None] * len(chunks)
+    for key, index in chunks.items():
+        unique[index] = key
+    return unique, indices
+
+
+def array(ctype, name, values, width):
+    lines = ["  const %s %s[%d] =" % (ctype, name, len(values)), "    {"]
+    per_line = 72 // (width + 2)
+    for i in range(0, len(values), per_line):
+        lines.append("      " + ", ".join("%*d" % (width, v)
+                                          for v in values[i:i+per_line]) + ",")
+    lines.append("    };")
+    return "\n".join(lines)
+
+
+def main():
+    index = {name: i for i, name in enumerate(CATEGORIES)}
+    categories = [index[unicodedata.category(chr(c))]
+                  for c in range(MAX_CHAR + 1)]
+
+    blocks, block_index = dedup(categories, BLOCK)
+    groups, group_index = dedup(block_index, GROUP)
+    assert len(groups) < 256 and len(blocks) < 65536
+
+    license = open(__file__).read().split("\n\n")[0].split("\n")[2:]
+    out = sys.stdout
+    out.write("/*\n")
+    for line in license:
+        out.write((" * " + line[2:]).rstrip() + "\n" if line != "#" else " *\n")
+    out.write(" */\n\n")
+    out.write("// generated by tools/gen_categories.py from Unicode %s\n\n"
+              % unicodedata.unidata_version)
+    out.write("#include <qre.hpp>\n\n")
+    out.write("namespace\n{\n")
+    out.write(array("uint8_t", "groups", group_index, 3) + "\n\n")
+    out.write(array("uint16_t", "blocks",
+                    [b for g in groups for b in g], 3) + "\n\n")
+    out.write(array("uint8_t", "categories",
+                    [c for b in blocks for c in b], 2) + "\n")
+    out.write("}\n\n")
+    out.write("""qre::general_category qre::category(char32_t ch)
+{
+  if(ch > max_char)
+    return general_category::Cn;
+  unsigned int block = blocks[groups[ch / %d] * %d + ch / %d %% %d];
+  return static_cast<general_category>(categories[block * %d + ch %% %d]);
+}
+""" % (BLOCK * GROUP, GROUP, BLOCK, GROUP, BLOCK, BLOCK))
+
+
+main()